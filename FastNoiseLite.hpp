@@ -63,6 +63,23 @@
 
 #include <cmath>
 
+// x86 builds get AVX2 versions of some kernels for GenUniformGrid...(), picked at runtime
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+#define FNL_X86_SIMD 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#else
+#define FNL_X86_SIMD 0
+#endif
+
+#if FNL_X86_SIMD && (defined(__GNUC__) || defined(__clang__))
+#define FNL_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define FNL_TARGET_AVX2
+#endif
+
 class FastNoiseLite
 {
 public:
@@ -349,6 +366,135 @@ public:
         }
     }
 
+    /// <summary>
+    /// 4D noise at given position using current settings
+    /// </summary>
+    /// <returns>
+    /// Noise output bounded between -1...1
+    /// </returns>
+    /// <remarks>
+    /// RotationType3D does not apply to 4D noise
+    /// </remarks>
+    template <typename FNfloat>
+    float GetNoise(FNfloat x, FNfloat y, FNfloat z, FNfloat w)
+    {
+        Arguments_must_be_floating_point_values<FNfloat>();
+
+        TransformNoiseCoordinate(x, y, z, w);
+
+        switch (mFractalType)
+        {
+        default:
+            return GenNoiseSingle(mSeed, x, y, z, w);
+        case FractalType_FBm:
+            return GenFractalFBm(x, y, z, w);
+        case FractalType_Ridged:
+            return GenFractalRidged(x, y, z, w);
+        case FractalType_PingPong:
+            return GenFractalPingPong(x, y, z, w);
+        }
+    }
+
+
+    /// <summary>
+    /// 3D noise for every point of an axis aligned grid using current settings
+    /// </summary>
+    /// <remarks>
+    /// noiseOut must hold xSize * ySize * zSize values, x changes fastest then y then z
+    /// Point (i, j, k) is (xStart + i * step, yStart + j * step, zStart + k * step)
+    /// Matches GetNoise(...) on each point up to float rounding
+    /// </remarks>
+    void GenUniformGrid3D(float* noiseOut, float xStart, float yStart, float zStart, int xSize, int ySize, int zSize, float step)
+    {
+        GetUniformGrid3DKernel()(*this, noiseOut, xStart, yStart, zStart, xSize, ySize, zSize, step);
+    }
+
+    /// <summary>
+    /// 4D noise for every point of an axis aligned grid using current settings
+    /// </summary>
+    /// <remarks>
+    /// noiseOut must hold xSize * ySize * zSize * wSize values, x changes fastest then y, z and w
+    /// Point (i, j, k, l) is (xStart + i * step, yStart + j * step, zStart + k * step, wStart + l * step)
+    /// Matches GetNoise(...) on each point up to float rounding
+    /// </remarks>
+    void GenUniformGrid4D(float* noiseOut, float xStart, float yStart, float zStart, float wStart, int xSize, int ySize, int zSize, int wSize, float step)
+    {
+        GetUniformGrid4DKernel()(*this, noiseOut, xStart, yStart, zStart, wStart, xSize, ySize, zSize, wSize, step);
+    }
+
+    typedef void (*UniformGrid3DKernel)(FastNoiseLite& noise, float* noiseOut, float xStart, float yStart, float zStart, int xSize, int ySize, int zSize, float step);
+    typedef void (*UniformGrid4DKernel)(FastNoiseLite& noise, float* noiseOut, float xStart, float yStart, float zStart, float wStart, int xSize, int ySize, int zSize, int wSize, float step);
+
+    /// <summary>
+    /// GenUniformGrid3D specialized at compile time for the current noise type and fractal type
+    /// </summary>
+    /// <remarks>
+    /// Other settings are still read from the instance passed in when called
+    /// Only needs fetching again after SetNoiseType(...) or SetFractalType(...)
+    /// </remarks>
+    /// <example>
+    /// <code>UniformGrid3DKernel kernel = noise.GetUniformGrid3DKernel()
+    /// kernel(noise, noiseOut, xStart, yStart, zStart, xSize, ySize, zSize, step)</code>
+    /// </example>
+    UniformGrid3DKernel GetUniformGrid3DKernel() const
+    {
+        switch (mFractalType)
+        {
+        default:
+            return GetUniformGrid3DKernel<FractalType_None>();
+        case FractalType_FBm:
+            return GetUniformGrid3DKernel<FractalType_FBm>();
+        case FractalType_Ridged:
+            return GetUniformGrid3DKernel<FractalType_Ridged>();
+        case FractalType_PingPong:
+            return GetUniformGrid3DKernel<FractalType_PingPong>();
+        }
+    }
+
+    /// <summary>
+    /// GenUniformGrid4D specialized at compile time for the current noise type and fractal type
+    /// </summary>
+    /// <remarks>
+    /// Other settings are still read from the instance passed in when called
+    /// Only needs fetching again after SetNoiseType(...) or SetFractalType(...)
+    /// </remarks>
+    UniformGrid4DKernel GetUniformGrid4DKernel() const
+    {
+        switch (mFractalType)
+        {
+        default:
+            return GetUniformGrid4DKernel<FractalType_None>();
+        case FractalType_FBm:
+            return GetUniformGrid4DKernel<FractalType_FBm>();
+        case FractalType_Ridged:
+            return GetUniformGrid4DKernel<FractalType_Ridged>();
+        case FractalType_PingPong:
+            return GetUniformGrid4DKernel<FractalType_PingPong>();
+        }
+    }
+
+    /// <summary>
+    /// Compile time configuration of the uniform grid kernels
+    /// </summary>
+    /// <remarks>
+    /// Fractal types other than FBm, Ridged and PingPong behave as FractalType_None
+    /// </remarks>
+    /// <example>
+    /// <code>FastNoiseLite::Specialized&lt;FastNoiseLite::NoiseType_Perlin, FastNoiseLite::FractalType_FBm&gt;::GenUniformGrid3D(noise, ...)</code>
+    /// </example>
+    template <NoiseType Noise, FractalType Fractal>
+    struct Specialized
+    {
+        static void GenUniformGrid3D(FastNoiseLite& noise, float* noiseOut, float xStart, float yStart, float zStart, int xSize, int ySize, int zSize, float step)
+        {
+            noise.GenUniformGrid3D<Noise, Fractal>(noiseOut, xStart, yStart, zStart, xSize, ySize, zSize, step);
+        }
+
+        static void GenUniformGrid4D(FastNoiseLite& noise, float* noiseOut, float xStart, float yStart, float zStart, float wStart, int xSize, int ySize, int zSize, int wSize, float step)
+        {
+            noise.GenUniformGrid4D<Noise, Fractal>(noiseOut, xStart, yStart, zStart, wStart, xSize, ySize, zSize, wSize, step);
+        }
+    };
 
     /// <summary>
     /// 2D warps the input position using current domain warp settings
@@ -444,8 +590,10 @@ public:
     {
         static const T Gradients2D[];
         static const T Gradients3D[];
+        static const T Gradients4D[];
         static const T RandVecs2D[];
         static const T RandVecs3D[];
+        static const T RandVecs4D[];
     };
 
     static float FastMin(float a, float b) { return a < b ? a : b; }
@@ -497,6 +645,7 @@ public:
     static const int PrimeX = 501125321;
     static const int PrimeY = 1136930381;
     static const int PrimeZ = 1720413743;
+    static const int PrimeW = 1066037191;
 
     static int Hash(int seed, int xPrimed, int yPrimed)
     {
@@ -516,6 +665,15 @@ public:
     }
 
 
+    static int Hash(int seed, int xPrimed, int yPrimed, int zPrimed, int wPrimed)
+    {
+        int hash = seed ^ xPrimed ^ yPrimed ^ zPrimed ^ wPrimed;
+
+        hash *= 0x27d4eb2d;
+        return hash;
+    }
+
+
     static float ValCoord(int seed, int xPrimed, int yPrimed)
     {
         int hash = Hash(seed, xPrimed, yPrimed);
@@ -536,6 +694,16 @@ public:
     }
 
 
+    static float ValCoord(int seed, int xPrimed, int yPrimed, int zPrimed, int wPrimed)
+    {
+        int hash = Hash(seed, xPrimed, yPrimed, zPrimed, wPrimed);
+
+        hash *= hash;
+        hash ^= hash << 19;
+        return hash * (1 / 2147483648.0f);
+    }
+
+
     float GradCoord(int seed, int xPrimed, int yPrimed, float xd, float yd)
     {
         int hash = Hash(seed, xPrimed, yPrimed);
@@ -563,6 +731,21 @@ public:
     }
 
 
+    float GradCoord(int seed, int xPrimed, int yPrimed, int zPrimed, int wPrimed, float xd, float yd, float zd, float wd)
+    {
+        int hash = Hash(seed, xPrimed, yPrimed, zPrimed, wPrimed);
+        hash ^= hash >> 15;
+        hash &= 63 << 2;
+
+        float xg = Lookup<float>::Gradients4D[hash];
+        float yg = Lookup<float>::Gradients4D[hash | 1];
+        float zg = Lookup<float>::Gradients4D[hash | 2];
+        float wg = Lookup<float>::Gradients4D[hash | 3];
+
+        return xd * xg + yd * yg + zd * zg + wd * wg;
+    }
+
+
     void GradCoordOut(int seed, int xPrimed, int yPrimed, float& xo, float& yo)
     {
         int hash = Hash(seed, xPrimed, yPrimed) & (255 << 1);
@@ -667,6 +850,28 @@ public:
         }
     }
 
+    template <typename FNfloat>
+    float GenNoiseSingle(int seed, FNfloat x, FNfloat y, FNfloat z, FNfloat w)
+    {
+        switch (mNoiseType)
+        {
+        case NoiseType_OpenSimplex2:
+            return SingleOpenSimplex2(seed, x, y, z, w);
+        case NoiseType_OpenSimplex2S:
+            return SingleOpenSimplex2S(seed, x, y, z, w);
+        case NoiseType_Cellular:
+            return SingleCellular(seed, x, y, z, w);
+        case NoiseType_Perlin:
+            return SinglePerlin(seed, x, y, z, w);
+        case NoiseType_ValueCubic:
+            return SingleValueCubic(seed, x, y, z, w);
+        case NoiseType_Value:
+            return SingleValue(seed, x, y, z, w);
+        default:
+            return 0;
+        }
+    }
+
 
     // Noise Coordinate Transforms (frequency, and possible skew or rotation)
 
@@ -736,6 +941,33 @@ public:
         }
     }
 
+    template <typename FNfloat>
+    void TransformNoiseCoordinate(FNfloat& x, FNfloat& y, FNfloat& z, FNfloat& w)
+    {
+        x *= mFrequency;
+        y *= mFrequency;
+        z *= mFrequency;
+        w *= mFrequency;
+
+        switch (mNoiseType)
+        {
+        case NoiseType_OpenSimplex2:
+        case NoiseType_OpenSimplex2S:
+            {
+                const FNfloat SQRT5 = (FNfloat)2.2360679774997896964091736687313;
+                const FNfloat F4 = (SQRT5 - 1) / 4;
+                FNfloat t = (x + y + z + w) * F4;
+                x += t;
+                y += t;
+                z += t;
+                w += t;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
     void UpdateTransformType3D()
     {
         switch (mRotationType3D)
@@ -894,6 +1126,29 @@ public:
         return sum;
     }
 
+    template <typename FNfloat>
+    float GenFractalFBm(FNfloat x, FNfloat y, FNfloat z, FNfloat w)
+    {
+        int seed = mSeed;
+        float sum = 0;
+        float amp = mFractalBounding;
+
+        for (int i = 0; i < mOctaves; i++)
+        {
+            float noise = GenNoiseSingle(seed++, x, y, z, w);
+            sum += noise * amp;
+            amp *= Lerp(1.0f, (noise + 1) * 0.5f, mWeightedStrength);
+
+            x *= mLacunarity;
+            y *= mLacunarity;
+            z *= mLacunarity;
+            w *= mLacunarity;
+            amp *= mGain;
+        }
+
+        return sum;
+    }
+
 
     // Fractal Ridged
 
@@ -940,6 +1195,29 @@ public:
         return sum;
     }
 
+    template <typename FNfloat>
+    float GenFractalRidged(FNfloat x, FNfloat y, FNfloat z, FNfloat w)
+    {
+        int seed = mSeed;
+        float sum = 0;
+        float amp = mFractalBounding;
+
+        for (int i = 0; i < mOctaves; i++)
+        {
+            float noise = FastAbs(GenNoiseSingle(seed++, x, y, z, w));
+            sum += (noise * -2 + 1) * amp;
+            amp *= Lerp(1.0f, 1 - noise, mWeightedStrength);
+
+            x *= mLacunarity;
+            y *= mLacunarity;
+            z *= mLacunarity;
+            w *= mLacunarity;
+            amp *= mGain;
+        }
+
+        return sum;
+    }
+
 
     // Fractal PingPong 
 
@@ -986,55 +1264,473 @@ public:
         return sum;
     }
 
-
-    // Simplex/OpenSimplex2 Noise
-
     template <typename FNfloat>
-    float SingleSimplex(int seed, FNfloat x, FNfloat y)
+    float GenFractalPingPong(FNfloat x, FNfloat y, FNfloat z, FNfloat w)
     {
-        // 2D OpenSimplex2 case uses the same algorithm as ordinary Simplex.
+        int seed = mSeed;
+        float sum = 0;
+        float amp = mFractalBounding;
 
-        const float SQRT3 = 1.7320508075688772935274463415059f;
-        const float G2 = (3 - SQRT3) / 6;
+        for (int i = 0; i < mOctaves; i++)
+        {
+            float noise = PingPong((GenNoiseSingle(seed++, x, y, z, w) + 1) * mPingPongStength);
+            sum += (noise - 0.5f) * 2 * amp;
+            amp *= Lerp(1.0f, noise, mWeightedStrength);
 
-        /*
-         * --- Skew moved to TransformNoiseCoordinate method ---
-         * const FNfloat F2 = 0.5f * (SQRT3 - 1);
-         * FNfloat s = (x + y) * F2;
-         * x += s; y += s;
-        */
+            x *= mLacunarity;
+            y *= mLacunarity;
+            z *= mLacunarity;
+            w *= mLacunarity;
+            amp *= mGain;
+        }
 
-        int i = FastFloor(x);
-        int j = FastFloor(y);
-        float xi = (float)(x - i);
-        float yi = (float)(y - j);
+        return sum;
+    }
 
-        float t = (xi + yi) * G2;
-        float x0 = (float)(xi - t);
-        float y0 = (float)(yi - t);
 
-        i *= PrimeX;
-        j *= PrimeY;
+    // Uniform Grid
 
-        float n0, n1, n2;
+    // Points are generated and evaluated in chunks along x, the noise type and fractal type are
+    // template parameters so nothing is switched on per point
+    static const int GridChunkSize = 64;
 
-        float a = 0.5f - x0 * x0 - y0 * y0;
-        if (a <= 0) n0 = 0;
-        else
+    template <NoiseType Noise, typename FNfloat>
+    float GenNoiseSingle(int seed, FNfloat x, FNfloat y, FNfloat z)
+    {
+        switch (Noise)
         {
-            n0 = (a * a) * (a * a) * GradCoord(seed, i, j, x0, y0);
+        case NoiseType_OpenSimplex2:
+            return SingleOpenSimplex2(seed, x, y, z);
+        case NoiseType_OpenSimplex2S:
+            return SingleOpenSimplex2S(seed, x, y, z);
+        case NoiseType_Cellular:
+            return SingleCellular(seed, x, y, z);
+        case NoiseType_Perlin:
+            return SinglePerlin(seed, x, y, z);
+        case NoiseType_ValueCubic:
+            return SingleValueCubic(seed, x, y, z);
+        case NoiseType_Value:
+            return SingleValue(seed, x, y, z);
+        default:
+            return 0;
         }
+    }
 
-        float c = (float)(2 * (1 - 2 * G2) * (1 / G2 - 2)) * t + ((float)(-2 * (1 - 2 * G2) * (1 - 2 * G2)) + a);
-        if (c <= 0) n2 = 0;
-        else
+    template <NoiseType Noise, typename FNfloat>
+    float GenNoiseSingle(int seed, FNfloat x, FNfloat y, FNfloat z, FNfloat w)
+    {
+        switch (Noise)
         {
-            float x2 = x0 + (2 * (float)G2 - 1);
-            float y2 = y0 + (2 * (float)G2 - 1);
-            n2 = (c * c) * (c * c) * GradCoord(seed, i + PrimeX, j + PrimeY, x2, y2);
+        case NoiseType_OpenSimplex2:
+            return SingleOpenSimplex2(seed, x, y, z, w);
+        case NoiseType_OpenSimplex2S:
+            return SingleOpenSimplex2S(seed, x, y, z, w);
+        case NoiseType_Cellular:
+            return SingleCellular(seed, x, y, z, w);
+        case NoiseType_Perlin:
+            return SinglePerlin(seed, x, y, z, w);
+        case NoiseType_ValueCubic:
+            return SingleValueCubic(seed, x, y, z, w);
+        case NoiseType_Value:
+            return SingleValue(seed, x, y, z, w);
+        default:
+            return 0;
         }
+    }
 
-        if (y0 > x0)
+    template <FractalType Fractal>
+    UniformGrid3DKernel GetUniformGrid3DKernel() const
+    {
+        switch (mNoiseType)
+        {
+        default:
+        case NoiseType_OpenSimplex2:
+            return &Specialized<NoiseType_OpenSimplex2, Fractal>::GenUniformGrid3D;
+        case NoiseType_OpenSimplex2S:
+            return &Specialized<NoiseType_OpenSimplex2S, Fractal>::GenUniformGrid3D;
+        case NoiseType_Cellular:
+            return &Specialized<NoiseType_Cellular, Fractal>::GenUniformGrid3D;
+        case NoiseType_Perlin:
+            return &Specialized<NoiseType_Perlin, Fractal>::GenUniformGrid3D;
+        case NoiseType_ValueCubic:
+            return &Specialized<NoiseType_ValueCubic, Fractal>::GenUniformGrid3D;
+        case NoiseType_Value:
+            return &Specialized<NoiseType_Value, Fractal>::GenUniformGrid3D;
+        }
+    }
+
+    template <FractalType Fractal>
+    UniformGrid4DKernel GetUniformGrid4DKernel() const
+    {
+        switch (mNoiseType)
+        {
+        default:
+        case NoiseType_OpenSimplex2:
+            return &Specialized<NoiseType_OpenSimplex2, Fractal>::GenUniformGrid4D;
+        case NoiseType_OpenSimplex2S:
+            return &Specialized<NoiseType_OpenSimplex2S, Fractal>::GenUniformGrid4D;
+        case NoiseType_Cellular:
+            return &Specialized<NoiseType_Cellular, Fractal>::GenUniformGrid4D;
+        case NoiseType_Perlin:
+            return &Specialized<NoiseType_Perlin, Fractal>::GenUniformGrid4D;
+        case NoiseType_ValueCubic:
+            return &Specialized<NoiseType_ValueCubic, Fractal>::GenUniformGrid4D;
+        case NoiseType_Value:
+            return &Specialized<NoiseType_Value, Fractal>::GenUniformGrid4D;
+        }
+    }
+
+    template <NoiseType Noise, FractalType Fractal>
+    void GenUniformGrid3D(float* noiseOut, float xStart, float yStart, float zStart, int xSize, int ySize, int zSize, float step)
+    {
+        // Transforms are linear, so the start of each row is transformed and the transformed x step is added on from there
+        float xStepX = step, xStepY = 0, xStepZ = 0;
+        TransformNoiseCoordinate(xStepX, xStepY, xStepZ);
+
+        float xs[GridChunkSize], ys[GridChunkSize], zs[GridChunkSize];
+
+        FractalOctave tableOctaves[GridTableOctaves];
+        FractalOctave* octaves = mOctaves > GridTableOctaves ? new FractalOctave[mOctaves] : tableOctaves;
+        BuildFractalOctaves(octaves);
+
+        for (int k = 0; k < zSize; k++)
+        {
+            for (int j = 0; j < ySize; j++)
+            {
+                float rowX = xStart;
+                float rowY = yStart + j * step;
+                float rowZ = zStart + k * step;
+                TransformNoiseCoordinate(rowX, rowY, rowZ);
+
+                for (int i0 = 0; i0 < xSize; i0 += GridChunkSize)
+                {
+                    int count = xSize - i0 < GridChunkSize ? xSize - i0 : GridChunkSize;
+
+                    for (int c = 0; c < count; c++)
+                    {
+                        xs[c] = rowX + (i0 + c) * xStepX;
+                        ys[c] = rowY + (i0 + c) * xStepY;
+                        zs[c] = rowZ + (i0 + c) * xStepZ;
+                    }
+
+                    GenGridChunk<Noise, Fractal>(noiseOut, xs, ys, zs, count, octaves);
+                    noiseOut += count;
+                }
+            }
+        }
+
+        if (octaves != tableOctaves) delete[] octaves;
+    }
+
+    template <NoiseType Noise, FractalType Fractal>
+    void GenUniformGrid4D(float* noiseOut, float xStart, float yStart, float zStart, float wStart, int xSize, int ySize, int zSize, int wSize, float step)
+    {
+        float xStepX = step, xStepY = 0, xStepZ = 0, xStepW = 0;
+        TransformNoiseCoordinate(xStepX, xStepY, xStepZ, xStepW);
+
+        float xs[GridChunkSize], ys[GridChunkSize], zs[GridChunkSize], ws[GridChunkSize];
+
+        FractalOctave tableOctaves[GridTableOctaves];
+        FractalOctave* octaves = mOctaves > GridTableOctaves ? new FractalOctave[mOctaves] : tableOctaves;
+        BuildFractalOctaves(octaves);
+
+        for (int l = 0; l < wSize; l++)
+        {
+            for (int k = 0; k < zSize; k++)
+            {
+                for (int j = 0; j < ySize; j++)
+                {
+                    float rowX = xStart;
+                    float rowY = yStart + j * step;
+                    float rowZ = zStart + k * step;
+                    float rowW = wStart + l * step;
+                    TransformNoiseCoordinate(rowX, rowY, rowZ, rowW);
+
+                    for (int i0 = 0; i0 < xSize; i0 += GridChunkSize)
+                    {
+                        int count = xSize - i0 < GridChunkSize ? xSize - i0 : GridChunkSize;
+
+                        for (int c = 0; c < count; c++)
+                        {
+                            xs[c] = rowX + (i0 + c) * xStepX;
+                            ys[c] = rowY + (i0 + c) * xStepY;
+                            zs[c] = rowZ + (i0 + c) * xStepZ;
+                            ws[c] = rowW + (i0 + c) * xStepW;
+                        }
+
+                        GenGridChunk<Noise, Fractal>(noiseOut, xs, ys, zs, ws, count, octaves);
+                        noiseOut += count;
+                    }
+                }
+            }
+        }
+
+        if (octaves != tableOctaves) delete[] octaves;
+    }
+
+    struct FractalOctave
+    {
+        float frequency; // Multiplier on the transformed coordinate, lacunarity to the power of the octave
+        float amplitude; // Weight before weighted strength is applied
+        int seed;
+    };
+
+    // Octave tables up to this size live on the stack
+    static const int GridTableOctaves = 64;
+
+    void BuildFractalOctaves(FractalOctave* octaves)
+    {
+        // Same running products as GenFractal...() so the weights match exactly
+        float frequency = 1;
+        float amp = mFractalBounding;
+        int seed = mSeed;
+
+        for (int i = 0; i < mOctaves; i++)
+        {
+            octaves[i].frequency = frequency;
+            octaves[i].amplitude = amp;
+            octaves[i].seed = seed++;
+
+            frequency *= mLacunarity;
+            amp *= mGain;
+        }
+    }
+
+    template <NoiseType Noise, FractalType Fractal>
+    void GenGridChunk(float* noiseOut, const float* xs, const float* ys, const float* zs, int count, const FractalOctave* octaves)
+    {
+        if (Fractal != FractalType_FBm && Fractal != FractalType_Ridged && Fractal != FractalType_PingPong)
+        {
+            GenNoiseChunk<Noise>(mSeed, xs, ys, zs, noiseOut, count);
+            return;
+        }
+
+        // Every octave scales the chunk coordinates from the table, so octaves don't depend on each other
+        float noise[GridChunkSize];
+        float amps[GridChunkSize];
+        float ox[GridChunkSize], oy[GridChunkSize], oz[GridChunkSize];
+        bool weighted = mWeightedStrength != 0;
+
+        for (int c = 0; c < count; c++)
+        {
+            noiseOut[c] = 0;
+            amps[c] = mFractalBounding;
+        }
+
+        for (int i = 0; i < mOctaves; i++)
+        {
+            float frequency = octaves[i].frequency;
+            for (int c = 0; c < count; c++)
+            {
+                ox[c] = xs[c] * frequency;
+                oy[c] = ys[c] * frequency;
+                oz[c] = zs[c] * frequency;
+            }
+
+            GenNoiseChunk<Noise>(octaves[i].seed, ox, oy, oz, noise, count);
+
+            if (weighted)
+                CombineWeightedFractalChunk<Fractal>(noiseOut, noise, amps, count);
+            else
+                CombineFractalChunk<Fractal>(noiseOut, noise, octaves[i].amplitude, count);
+        }
+    }
+
+    template <NoiseType Noise, FractalType Fractal>
+    void GenGridChunk(float* noiseOut, const float* xs, const float* ys, const float* zs, const float* ws, int count, const FractalOctave* octaves)
+    {
+        if (Fractal != FractalType_FBm && Fractal != FractalType_Ridged && Fractal != FractalType_PingPong)
+        {
+            GenNoiseChunk<Noise>(mSeed, xs, ys, zs, ws, noiseOut, count);
+            return;
+        }
+
+        float noise[GridChunkSize];
+        float amps[GridChunkSize];
+        float ox[GridChunkSize], oy[GridChunkSize], oz[GridChunkSize], ow[GridChunkSize];
+        bool weighted = mWeightedStrength != 0;
+
+        for (int c = 0; c < count; c++)
+        {
+            noiseOut[c] = 0;
+            amps[c] = mFractalBounding;
+        }
+
+        for (int i = 0; i < mOctaves; i++)
+        {
+            float frequency = octaves[i].frequency;
+            for (int c = 0; c < count; c++)
+            {
+                ox[c] = xs[c] * frequency;
+                oy[c] = ys[c] * frequency;
+                oz[c] = zs[c] * frequency;
+                ow[c] = ws[c] * frequency;
+            }
+
+            GenNoiseChunk<Noise>(octaves[i].seed, ox, oy, oz, ow, noise, count);
+
+            if (weighted)
+                CombineWeightedFractalChunk<Fractal>(noiseOut, noise, amps, count);
+            else
+                CombineFractalChunk<Fractal>(noiseOut, noise, octaves[i].amplitude, count);
+        }
+    }
+
+    // Without weighted strength every point of an octave has the same amplitude
+    template <FractalType Fractal>
+    void CombineFractalChunk(float* noiseOut, const float* noise, float amp, int count)
+    {
+        switch (Fractal)
+        {
+        default:
+        case FractalType_FBm:
+            for (int c = 0; c < count; c++)
+            {
+                noiseOut[c] += noise[c] * amp;
+            }
+            break;
+        case FractalType_Ridged:
+            for (int c = 0; c < count; c++)
+            {
+                noiseOut[c] += (FastAbs(noise[c]) * -2 + 1) * amp;
+            }
+            break;
+        case FractalType_PingPong:
+            for (int c = 0; c < count; c++)
+            {
+                noiseOut[c] += (PingPong((noise[c] + 1) * mPingPongStength) - 0.5f) * 2 * amp;
+            }
+            break;
+        }
+    }
+
+    // Same operations in the same order as GenFractal...(), amps holds the running amplitude of each point
+    template <FractalType Fractal>
+    void CombineWeightedFractalChunk(float* noiseOut, const float* noise, float* amps, int count)
+    {
+        switch (Fractal)
+        {
+        default:
+        case FractalType_FBm:
+            for (int c = 0; c < count; c++)
+            {
+                noiseOut[c] += noise[c] * amps[c];
+                amps[c] *= Lerp(1.0f, (noise[c] + 1) * 0.5f, mWeightedStrength);
+                amps[c] *= mGain;
+            }
+            break;
+        case FractalType_Ridged:
+            for (int c = 0; c < count; c++)
+            {
+                float ridged = FastAbs(noise[c]);
+                noiseOut[c] += (ridged * -2 + 1) * amps[c];
+                amps[c] *= Lerp(1.0f, 1 - ridged, mWeightedStrength);
+                amps[c] *= mGain;
+            }
+            break;
+        case FractalType_PingPong:
+            for (int c = 0; c < count; c++)
+            {
+                float pingPong = PingPong((noise[c] + 1) * mPingPongStength);
+                noiseOut[c] += (pingPong - 0.5f) * 2 * amps[c];
+                amps[c] *= Lerp(1.0f, pingPong, mWeightedStrength);
+                amps[c] *= mGain;
+            }
+            break;
+        }
+    }
+
+    template <NoiseType Noise>
+    void GenNoiseChunk(int seed, const float* xs, const float* ys, const float* zs, float* noiseOut, int count)
+    {
+#if FNL_X86_SIMD
+        if ((Noise == NoiseType_OpenSimplex2 || Noise == NoiseType_Perlin) && CpuSupportsAVX2())
+        {
+            GenNoiseChunkAVX2<Noise>(seed, xs, ys, zs, noiseOut, count);
+            return;
+        }
+        if (Noise == NoiseType_Cellular && CpuSupportsAVX2())
+        {
+            GenCellularChunkAVX2(seed, xs, ys, zs, noiseOut, count);
+            return;
+        }
+#endif
+        for (int c = 0; c < count; c++)
+        {
+            noiseOut[c] = GenNoiseSingle<Noise>(seed, xs[c], ys[c], zs[c]);
+        }
+    }
+
+    template <NoiseType Noise>
+    void GenNoiseChunk(int seed, const float* xs, const float* ys, const float* zs, const float* ws, float* noiseOut, int count)
+    {
+#if FNL_X86_SIMD
+        if ((Noise == NoiseType_OpenSimplex2 || Noise == NoiseType_Perlin) && CpuSupportsAVX2())
+        {
+            GenNoiseChunkAVX2<Noise>(seed, xs, ys, zs, ws, noiseOut, count);
+            return;
+        }
+        if (Noise == NoiseType_Cellular && CpuSupportsAVX2())
+        {
+            GenCellularChunkAVX2(seed, xs, ys, zs, ws, noiseOut, count);
+            return;
+        }
+#endif
+        for (int c = 0; c < count; c++)
+        {
+            noiseOut[c] = GenNoiseSingle<Noise>(seed, xs[c], ys[c], zs[c], ws[c]);
+        }
+    }
+
+
+    // Simplex/OpenSimplex2 Noise
+
+    template <typename FNfloat>
+    float SingleSimplex(int seed, FNfloat x, FNfloat y)
+    {
+        // 2D OpenSimplex2 case uses the same algorithm as ordinary Simplex.
+
+        const float SQRT3 = 1.7320508075688772935274463415059f;
+        const float G2 = (3 - SQRT3) / 6;
+
+        /*
+         * --- Skew moved to TransformNoiseCoordinate method ---
+         * const FNfloat F2 = 0.5f * (SQRT3 - 1);
+         * FNfloat s = (x + y) * F2;
+         * x += s; y += s;
+        */
+
+        int i = FastFloor(x);
+        int j = FastFloor(y);
+        float xi = (float)(x - i);
+        float yi = (float)(y - j);
+
+        float t = (xi + yi) * G2;
+        float x0 = (float)(xi - t);
+        float y0 = (float)(yi - t);
+
+        i *= PrimeX;
+        j *= PrimeY;
+
+        float n0, n1, n2;
+
+        float a = 0.5f - x0 * x0 - y0 * y0;
+        if (a <= 0) n0 = 0;
+        else
+        {
+            n0 = (a * a) * (a * a) * GradCoord(seed, i, j, x0, y0);
+        }
+
+        float c = (float)(2 * (1 - 2 * G2) * (1 / G2 - 2)) * t + ((float)(-2 * (1 - 2 * G2) * (1 - 2 * G2)) + a);
+        if (c <= 0) n2 = 0;
+        else
+        {
+            float x2 = x0 + (2 * (float)G2 - 1);
+            float y2 = y0 + (2 * (float)G2 - 1);
+            n2 = (c * c) * (c * c) * GradCoord(seed, i + PrimeX, j + PrimeY, x2, y2);
+        }
+
+        if (y0 > x0)
         {
             float x1 = x0 + (float)G2;
             float y1 = y0 + ((float)G2 - 1);
@@ -1159,6 +1855,95 @@ public:
         return value * 32.69428253173828125f;
     }
 
+    template <typename FNfloat>
+    float SingleOpenSimplex2(int seed, FNfloat x, FNfloat y, FNfloat z, FNfloat w)
+    {
+        // 4D OpenSimplex2 case uses the simplex lattice, the same as 2D.
+
+        /*
+         * --- Skew moved to TransformNoiseCoordinate method ---
+         * const FNfloat F4 = (SQRT5 - 1) / 4;
+         * FNfloat s = (x + y + z + w) * F4;
+         * x += s; y += s; z += s; w += s;
+        */
+
+        return SimplexLattice4D(seed, x, y, z, w) * 27.2256f;
+    }
+
+    template <typename FNfloat>
+    float SimplexLattice4D(int seed, FNfloat x, FNfloat y, FNfloat z, FNfloat w)
+    {
+        const float SQRT5 = 2.2360679774997896964091736687313f;
+        const float G4 = (5 - SQRT5) / 20;
+
+        int i = FastFloor(x);
+        int j = FastFloor(y);
+        int k = FastFloor(z);
+        int l = FastFloor(w);
+        float xi = (float)(x - i);
+        float yi = (float)(y - j);
+        float zi = (float)(z - k);
+        float wi = (float)(w - l);
+
+        float t = (xi + yi + zi + wi) * G4;
+        float x0 = xi - t;
+        float y0 = yi - t;
+        float z0 = zi - t;
+        float w0 = wi - t;
+
+        // Rank the axes against each other to find which of the 24 simplices in the hypercube we are in
+        int rankX = 0, rankY = 0, rankZ = 0, rankW = 0;
+        if (x0 > y0) rankX++; else rankY++;
+        if (x0 > z0) rankX++; else rankZ++;
+        if (x0 > w0) rankX++; else rankW++;
+        if (y0 > z0) rankY++; else rankZ++;
+        if (y0 > w0) rankY++; else rankW++;
+        if (z0 > w0) rankZ++; else rankW++;
+
+        i *= PrimeX;
+        j *= PrimeY;
+        k *= PrimeZ;
+        l *= PrimeW;
+
+        float value = 0;
+        float a = 0.6f - x0 * x0 - y0 * y0 - z0 * z0 - w0 * w0;
+        if (a > 0)
+        {
+            value += (a * a) * (a * a) * GradCoord(seed, i, j, k, l, x0, y0, z0, w0);
+        }
+
+        // Middle three vertices step along the highest ranked axes first
+        for (int n = 1; n < 4; n++)
+        {
+            int xMask = -(rankX >= 4 - n);
+            int yMask = -(rankY >= 4 - n);
+            int zMask = -(rankZ >= 4 - n);
+            int wMask = -(rankW >= 4 - n);
+
+            float xn = x0 + xMask + n * G4;
+            float yn = y0 + yMask + n * G4;
+            float zn = z0 + zMask + n * G4;
+            float wn = w0 + wMask + n * G4;
+            float an = 0.6f - xn * xn - yn * yn - zn * zn - wn * wn;
+            if (an > 0)
+            {
+                value += (an * an) * (an * an) * GradCoord(seed,
+                                                           i + (xMask & PrimeX), j + (yMask & PrimeY), k + (zMask & PrimeZ), l + (wMask & PrimeW), xn, yn, zn, wn);
+            }
+        }
+
+        float x4 = x0 + (4 * G4 - 1);
+        float y4 = y0 + (4 * G4 - 1);
+        float z4 = z0 + (4 * G4 - 1);
+        float w4 = w0 + (4 * G4 - 1);
+        float a4 = 0.6f - x4 * x4 - y4 * y4 - z4 * z4 - w4 * w4;
+        if (a4 > 0)
+        {
+            value += (a4 * a4) * (a4 * a4) * GradCoord(seed, i + PrimeX, j + PrimeY, k + PrimeZ, l + PrimeW, x4, y4, z4, w4);
+        }
+
+        return value;
+    }
 
     // OpenSimplex2S Noise
 
@@ -1486,6 +2271,24 @@ public:
         return value * 9.046026385208288f;
     }
 
+    template <typename FNfloat>
+    float SingleOpenSimplex2S(int seed, FNfloat x, FNfloat y, FNfloat z, FNfloat w)
+    {
+        // 4D OpenSimplex2S case sums two simplex lattices, the second offset onto the
+        // centroids of the first lattice's simplices, for a smoother and more even result.
+
+        /*
+         * --- Skew moved to TransformNoiseCoordinate method ---
+         * const FNfloat F4 = (SQRT5 - 1) / 4;
+         * FNfloat s = (x + y + z + w) * F4;
+         * x += s; y += s; z += s; w += s;
+        */
+
+        float value = SimplexLattice4D(seed, x, y, z, w);
+        value += SimplexLattice4D(seed + 1293373, x + (FNfloat)0.8, y + (FNfloat)0.6, z + (FNfloat)0.4, w + (FNfloat)0.2);
+
+        return value * 15.0033f;
+    }
 
     // Cellular Noise
 
@@ -1773,6 +2576,185 @@ public:
         }
     }
 
+    template <typename FNfloat>
+    float SingleCellular(int seed, FNfloat x, FNfloat y, FNfloat z, FNfloat w)
+    {
+        int xr = FastRound(x);
+        int yr = FastRound(y);
+        int zr = FastRound(z);
+        int wr = FastRound(w);
+
+        float distance0 = 1e10f;
+        float distance1 = 1e10f;
+        int closestHash = 0;
+
+        // Largest jitter where no cell outside the 3^4 block can hold a closer point, worst case is a point at a corner
+        // of its rounded cell: (sqrt(1.5^2 + 3 * 0.5^2) - sqrt(4 * 0.5^2)) / 2, the same bound gives the 2D and 3D values
+        float cellularJitter = 0.36602540f * mCellularJitterModifier;
+
+        // Unsigned so stepping the primes can wrap without being undefined
+        unsigned xPrimed = (unsigned)(xr - 1) * PrimeX;
+        unsigned yPrimedBase = (unsigned)(yr - 1) * PrimeY;
+        unsigned zPrimedBase = (unsigned)(zr - 1) * PrimeZ;
+        unsigned wPrimedBase = (unsigned)(wr - 1) * PrimeW;
+
+        switch (mCellularDistanceFunction)
+        {
+        case CellularDistanceFunction_Euclidean:
+        case CellularDistanceFunction_EuclideanSq:
+            for (int xi = xr - 1; xi <= xr + 1; xi++)
+            {
+                unsigned yPrimed = yPrimedBase;
+
+                for (int yi = yr - 1; yi <= yr + 1; yi++)
+                {
+                    unsigned zPrimed = zPrimedBase;
+
+                    for (int zi = zr - 1; zi <= zr + 1; zi++)
+                    {
+                        unsigned wPrimed = wPrimedBase;
+
+                        for (int wi = wr - 1; wi <= wr + 1; wi++)
+                        {
+                            int hash = Hash(seed, (int)xPrimed, (int)yPrimed, (int)zPrimed, (int)wPrimed);
+                            int idx = hash & (255 << 2);
+
+                            float vecX = (float)(xi - x) + Lookup<float>::RandVecs4D[idx] * cellularJitter;
+                            float vecY = (float)(yi - y) + Lookup<float>::RandVecs4D[idx | 1] * cellularJitter;
+                            float vecZ = (float)(zi - z) + Lookup<float>::RandVecs4D[idx | 2] * cellularJitter;
+                            float vecW = (float)(wi - w) + Lookup<float>::RandVecs4D[idx | 3] * cellularJitter;
+
+                            float newDistance = vecX * vecX + vecY * vecY + vecZ * vecZ + vecW * vecW;
+
+                            distance1 = FastMax(FastMin(distance1, newDistance), distance0);
+                            if (newDistance < distance0)
+                            {
+                                distance0 = newDistance;
+                                closestHash = hash;
+                            }
+                            wPrimed += PrimeW;
+                        }
+                        zPrimed += PrimeZ;
+                    }
+                    yPrimed += PrimeY;
+                }
+                xPrimed += PrimeX;
+            }
+            break;
+        case CellularDistanceFunction_Manhattan:
+            for (int xi = xr - 1; xi <= xr + 1; xi++)
+            {
+                unsigned yPrimed = yPrimedBase;
+
+                for (int yi = yr - 1; yi <= yr + 1; yi++)
+                {
+                    unsigned zPrimed = zPrimedBase;
+
+                    for (int zi = zr - 1; zi <= zr + 1; zi++)
+                    {
+                        unsigned wPrimed = wPrimedBase;
+
+                        for (int wi = wr - 1; wi <= wr + 1; wi++)
+                        {
+                            int hash = Hash(seed, (int)xPrimed, (int)yPrimed, (int)zPrimed, (int)wPrimed);
+                            int idx = hash & (255 << 2);
+
+                            float vecX = (float)(xi - x) + Lookup<float>::RandVecs4D[idx] * cellularJitter;
+                            float vecY = (float)(yi - y) + Lookup<float>::RandVecs4D[idx | 1] * cellularJitter;
+                            float vecZ = (float)(zi - z) + Lookup<float>::RandVecs4D[idx | 2] * cellularJitter;
+                            float vecW = (float)(wi - w) + Lookup<float>::RandVecs4D[idx | 3] * cellularJitter;
+
+                            float newDistance = FastAbs(vecX) + FastAbs(vecY) + FastAbs(vecZ) + FastAbs(vecW);
+
+                            distance1 = FastMax(FastMin(distance1, newDistance), distance0);
+                            if (newDistance < distance0)
+                            {
+                                distance0 = newDistance;
+                                closestHash = hash;
+                            }
+                            wPrimed += PrimeW;
+                        }
+                        zPrimed += PrimeZ;
+                    }
+                    yPrimed += PrimeY;
+                }
+                xPrimed += PrimeX;
+            }
+            break;
+        case CellularDistanceFunction_Hybrid:
+            for (int xi = xr - 1; xi <= xr + 1; xi++)
+            {
+                unsigned yPrimed = yPrimedBase;
+
+                for (int yi = yr - 1; yi <= yr + 1; yi++)
+                {
+                    unsigned zPrimed = zPrimedBase;
+
+                    for (int zi = zr - 1; zi <= zr + 1; zi++)
+                    {
+                        unsigned wPrimed = wPrimedBase;
+
+                        for (int wi = wr - 1; wi <= wr + 1; wi++)
+                        {
+                            int hash = Hash(seed, (int)xPrimed, (int)yPrimed, (int)zPrimed, (int)wPrimed);
+                            int idx = hash & (255 << 2);
+
+                            float vecX = (float)(xi - x) + Lookup<float>::RandVecs4D[idx] * cellularJitter;
+                            float vecY = (float)(yi - y) + Lookup<float>::RandVecs4D[idx | 1] * cellularJitter;
+                            float vecZ = (float)(zi - z) + Lookup<float>::RandVecs4D[idx | 2] * cellularJitter;
+                            float vecW = (float)(wi - w) + Lookup<float>::RandVecs4D[idx | 3] * cellularJitter;
+
+                            float newDistance = (FastAbs(vecX) + FastAbs(vecY) + FastAbs(vecZ) + FastAbs(vecW)) + (vecX * vecX + vecY * vecY + vecZ * vecZ + vecW * vecW);
+
+                            distance1 = FastMax(FastMin(distance1, newDistance), distance0);
+                            if (newDistance < distance0)
+                            {
+                                distance0 = newDistance;
+                                closestHash = hash;
+                            }
+                            wPrimed += PrimeW;
+                        }
+                        zPrimed += PrimeZ;
+                    }
+                    yPrimed += PrimeY;
+                }
+                xPrimed += PrimeX;
+            }
+            break;
+        default:
+            break;
+        }
+
+        if (mCellularDistanceFunction == CellularDistanceFunction_Euclidean && mCellularReturnType >= CellularReturnType_Distance)
+        {
+            distance0 = FastSqrt(distance0);
+
+            if (mCellularReturnType >= CellularReturnType_Distance2)
+            {
+                distance1 = FastSqrt(distance1);
+            }
+        }
+
+        switch (mCellularReturnType)
+        {
+        case CellularReturnType_CellValue:
+            return closestHash * (1 / 2147483648.0f);
+        case CellularReturnType_Distance:
+            return distance0 - 1;
+        case CellularReturnType_Distance2:
+            return distance1 - 1;
+        case CellularReturnType_Distance2Add:
+            return (distance1 + distance0) * 0.5f - 1;
+        case CellularReturnType_Distance2Sub:
+            return distance1 - distance0 - 1;
+        case CellularReturnType_Distance2Mul:
+            return distance1 * distance0 * 0.5f - 1;
+        case CellularReturnType_Distance2Div:
+            return distance0 / distance1 - 1;
+        default:
+            return 0;
+        }
+    }
 
     // Perlin Noise
 
@@ -1837,6 +2819,56 @@ public:
         return Lerp(yf0, yf1, zs) * 0.964921414852142333984375f;
     }
 
+    template <typename FNfloat>
+    float SinglePerlin(int seed, FNfloat x, FNfloat y, FNfloat z, FNfloat w)
+    {
+        int x0 = FastFloor(x);
+        int y0 = FastFloor(y);
+        int z0 = FastFloor(z);
+        int w0 = FastFloor(w);
+
+        float xd0 = (float)(x - x0);
+        float yd0 = (float)(y - y0);
+        float zd0 = (float)(z - z0);
+        float wd0 = (float)(w - w0);
+        float xd1 = xd0 - 1;
+        float yd1 = yd0 - 1;
+        float zd1 = zd0 - 1;
+        float wd1 = wd0 - 1;
+
+        float xs = InterpQuintic(xd0);
+        float ys = InterpQuintic(yd0);
+        float zs = InterpQuintic(zd0);
+        float ws = InterpQuintic(wd0);
+
+        x0 *= PrimeX;
+        y0 *= PrimeY;
+        z0 *= PrimeZ;
+        w0 *= PrimeW;
+        int x1 = x0 + PrimeX;
+        int y1 = y0 + PrimeY;
+        int z1 = z0 + PrimeZ;
+        int w1 = w0 + PrimeW;
+
+        float xf000 = Lerp(GradCoord(seed, x0, y0, z0, w0, xd0, yd0, zd0, wd0), GradCoord(seed, x1, y0, z0, w0, xd1, yd0, zd0, wd0), xs);
+        float xf100 = Lerp(GradCoord(seed, x0, y1, z0, w0, xd0, yd1, zd0, wd0), GradCoord(seed, x1, y1, z0, w0, xd1, yd1, zd0, wd0), xs);
+        float xf010 = Lerp(GradCoord(seed, x0, y0, z1, w0, xd0, yd0, zd1, wd0), GradCoord(seed, x1, y0, z1, w0, xd1, yd0, zd1, wd0), xs);
+        float xf110 = Lerp(GradCoord(seed, x0, y1, z1, w0, xd0, yd1, zd1, wd0), GradCoord(seed, x1, y1, z1, w0, xd1, yd1, zd1, wd0), xs);
+        float xf001 = Lerp(GradCoord(seed, x0, y0, z0, w1, xd0, yd0, zd0, wd1), GradCoord(seed, x1, y0, z0, w1, xd1, yd0, zd0, wd1), xs);
+        float xf101 = Lerp(GradCoord(seed, x0, y1, z0, w1, xd0, yd1, zd0, wd1), GradCoord(seed, x1, y1, z0, w1, xd1, yd1, zd0, wd1), xs);
+        float xf011 = Lerp(GradCoord(seed, x0, y0, z1, w1, xd0, yd0, zd1, wd1), GradCoord(seed, x1, y0, z1, w1, xd1, yd0, zd1, wd1), xs);
+        float xf111 = Lerp(GradCoord(seed, x0, y1, z1, w1, xd0, yd1, zd1, wd1), GradCoord(seed, x1, y1, z1, w1, xd1, yd1, zd1, wd1), xs);
+
+        float yf00 = Lerp(xf000, xf100, ys);
+        float yf10 = Lerp(xf010, xf110, ys);
+        float yf01 = Lerp(xf001, xf101, ys);
+        float yf11 = Lerp(xf011, xf111, ys);
+
+        float zf0 = Lerp(yf00, yf10, zs);
+        float zf1 = Lerp(yf01, yf11, zs);
+
+        return Lerp(zf0, zf1, ws) * 0.797474f;
+    }
 
     // Value Cubic Noise
 
@@ -1924,6 +2956,50 @@ public:
             zs) * (1 / (1.5f * 1.5f * 1.5f));
     }
 
+    template <typename FNfloat>
+    float SingleValueCubic(int seed, FNfloat x, FNfloat y, FNfloat z, FNfloat w)
+    {
+        int x1 = FastFloor(x);
+        int y1 = FastFloor(y);
+        int z1 = FastFloor(z);
+        int w1 = FastFloor(w);
+
+        float xs = (float)(x - x1);
+        float ys = (float)(y - y1);
+        float zs = (float)(z - z1);
+        float ws = (float)(w - w1);
+
+        x1 *= PrimeX;
+        y1 *= PrimeY;
+        z1 *= PrimeZ;
+        w1 *= PrimeW;
+
+        // 4x4x4x4 neighbourhood is too large to write out like 3D, collapse one axis at a time instead
+        int xp[4] = { x1 - PrimeX, x1, x1 + PrimeX, x1 + (int)((long)PrimeX << 1) };
+        int yp[4] = { y1 - PrimeY, y1, y1 + PrimeY, y1 + (int)((long)PrimeY << 1) };
+        int zp[4] = { z1 - PrimeZ, z1, z1 + PrimeZ, z1 + (int)((long)PrimeZ << 1) };
+        int wp[4] = { w1 - PrimeW, w1, w1 + PrimeW, w1 + (int)((long)PrimeW << 1) };
+
+        float wf[4];
+        for (int l = 0; l < 4; l++)
+        {
+            float zf[4];
+            for (int k = 0; k < 4; k++)
+            {
+                float yf[4];
+                for (int j = 0; j < 4; j++)
+                {
+                    yf[j] = CubicLerp(ValCoord(seed, xp[0], yp[j], zp[k], wp[l]), ValCoord(seed, xp[1], yp[j], zp[k], wp[l]),
+                                      ValCoord(seed, xp[2], yp[j], zp[k], wp[l]), ValCoord(seed, xp[3], yp[j], zp[k], wp[l]), xs);
+                }
+                zf[k] = CubicLerp(yf[0], yf[1], yf[2], yf[3], ys);
+            }
+            wf[l] = CubicLerp(zf[0], zf[1], zf[2], zf[3], zs);
+        }
+
+        // 1.5^-4 like the lower dimensions would leave 4D at about +-0.37, the largest unscaled value over 64M random points was 1.9524
+        return CubicLerp(wf[0], wf[1], wf[2], wf[3], ws) * (1 / 1.9525f);
+    }
 
     // Value Noise
 
@@ -1964,19 +3040,60 @@ public:
         int x1 = x0 + PrimeX;
         int y1 = y0 + PrimeY;
         int z1 = z0 + PrimeZ;
-
-        float xf00 = Lerp(ValCoord(seed, x0, y0, z0), ValCoord(seed, x1, y0, z0), xs);
-        float xf10 = Lerp(ValCoord(seed, x0, y1, z0), ValCoord(seed, x1, y1, z0), xs);
-        float xf01 = Lerp(ValCoord(seed, x0, y0, z1), ValCoord(seed, x1, y0, z1), xs);
-        float xf11 = Lerp(ValCoord(seed, x0, y1, z1), ValCoord(seed, x1, y1, z1), xs);
-
-        float yf0 = Lerp(xf00, xf10, ys);
-        float yf1 = Lerp(xf01, xf11, ys);
-
-        return Lerp(yf0, yf1, zs);
+
+        float xf00 = Lerp(ValCoord(seed, x0, y0, z0), ValCoord(seed, x1, y0, z0), xs);
+        float xf10 = Lerp(ValCoord(seed, x0, y1, z0), ValCoord(seed, x1, y1, z0), xs);
+        float xf01 = Lerp(ValCoord(seed, x0, y0, z1), ValCoord(seed, x1, y0, z1), xs);
+        float xf11 = Lerp(ValCoord(seed, x0, y1, z1), ValCoord(seed, x1, y1, z1), xs);
+
+        float yf0 = Lerp(xf00, xf10, ys);
+        float yf1 = Lerp(xf01, xf11, ys);
+
+        return Lerp(yf0, yf1, zs);
+    }
+
+    template <typename FNfloat>
+    float SingleValue(int seed, FNfloat x, FNfloat y, FNfloat z, FNfloat w)
+    {
+        int x0 = FastFloor(x);
+        int y0 = FastFloor(y);
+        int z0 = FastFloor(z);
+        int w0 = FastFloor(w);
+
+        float xs = InterpHermite((float)(x - x0));
+        float ys = InterpHermite((float)(y - y0));
+        float zs = InterpHermite((float)(z - z0));
+        float ws = InterpHermite((float)(w - w0));
+
+        x0 *= PrimeX;
+        y0 *= PrimeY;
+        z0 *= PrimeZ;
+        w0 *= PrimeW;
+        int x1 = x0 + PrimeX;
+        int y1 = y0 + PrimeY;
+        int z1 = z0 + PrimeZ;
+        int w1 = w0 + PrimeW;
+
+        float xf000 = Lerp(ValCoord(seed, x0, y0, z0, w0), ValCoord(seed, x1, y0, z0, w0), xs);
+        float xf100 = Lerp(ValCoord(seed, x0, y1, z0, w0), ValCoord(seed, x1, y1, z0, w0), xs);
+        float xf010 = Lerp(ValCoord(seed, x0, y0, z1, w0), ValCoord(seed, x1, y0, z1, w0), xs);
+        float xf110 = Lerp(ValCoord(seed, x0, y1, z1, w0), ValCoord(seed, x1, y1, z1, w0), xs);
+        float xf001 = Lerp(ValCoord(seed, x0, y0, z0, w1), ValCoord(seed, x1, y0, z0, w1), xs);
+        float xf101 = Lerp(ValCoord(seed, x0, y1, z0, w1), ValCoord(seed, x1, y1, z0, w1), xs);
+        float xf011 = Lerp(ValCoord(seed, x0, y0, z1, w1), ValCoord(seed, x1, y0, z1, w1), xs);
+        float xf111 = Lerp(ValCoord(seed, x0, y1, z1, w1), ValCoord(seed, x1, y1, z1, w1), xs);
+
+        float yf00 = Lerp(xf000, xf100, ys);
+        float yf10 = Lerp(xf010, xf110, ys);
+        float yf01 = Lerp(xf001, xf101, ys);
+        float yf11 = Lerp(xf011, xf111, ys);
+
+        float zf0 = Lerp(yf00, yf10, zs);
+        float zf1 = Lerp(yf01, yf11, zs);
+
+        return Lerp(zf0, zf1, ws);
     }
 
-
     // Domain Warp
 
     template <typename FNfloat>
@@ -2452,6 +3569,777 @@ public:
         yr += vy * warpAmp;
         zr += vz * warpAmp;
     }
+
+#if FNL_X86_SIMD
+    // AVX2 Kernels
+    // Eight points at a time, each one follows the same operations as its scalar version
+
+    static bool CpuSupportsAVX2()
+    {
+#if defined(_MSC_VER)
+        static const bool supported = []
+        {
+            int info[4];
+            __cpuid(info, 0);
+            if (info[0] < 7) return false;
+            __cpuid(info, 1);
+            bool osxsave = (info[2] & (1 << 27)) != 0;
+            bool avx = (info[2] & (1 << 28)) != 0;
+            if (!osxsave || !avx || (_xgetbv(0) & 6) != 6) return false;
+            __cpuidex(info, 7, 0);
+            return (info[1] & (1 << 5)) != 0;
+        }();
+#else
+        static const bool supported = __builtin_cpu_supports("avx2");
+#endif
+        return supported;
+    }
+
+    template <NoiseType Noise>
+    FNL_TARGET_AVX2 void GenNoiseChunkAVX2(int seed, const float* xs, const float* ys, const float* zs, float* noiseOut, int count)
+    {
+        int c = 0;
+        for (; c + 8 <= count; c += 8)
+        {
+            __m256 noise = Noise == NoiseType_Perlin ?
+                SinglePerlinAVX2(seed, _mm256_loadu_ps(xs + c), _mm256_loadu_ps(ys + c), _mm256_loadu_ps(zs + c)) :
+                SingleOpenSimplex2AVX2(seed, _mm256_loadu_ps(xs + c), _mm256_loadu_ps(ys + c), _mm256_loadu_ps(zs + c));
+            _mm256_storeu_ps(noiseOut + c, noise);
+        }
+
+        if (c < count)
+        {
+            float x[8] = {}, y[8] = {}, z[8] = {}, out[8];
+            for (int i = 0; i < count - c; i++)
+            {
+                x[i] = xs[c + i];
+                y[i] = ys[c + i];
+                z[i] = zs[c + i];
+            }
+            __m256 noise = Noise == NoiseType_Perlin ?
+                SinglePerlinAVX2(seed, _mm256_loadu_ps(x), _mm256_loadu_ps(y), _mm256_loadu_ps(z)) :
+                SingleOpenSimplex2AVX2(seed, _mm256_loadu_ps(x), _mm256_loadu_ps(y), _mm256_loadu_ps(z));
+            _mm256_storeu_ps(out, noise);
+            for (int i = 0; i < count - c; i++)
+            {
+                noiseOut[c + i] = out[i];
+            }
+        }
+    }
+
+    template <NoiseType Noise>
+    FNL_TARGET_AVX2 void GenNoiseChunkAVX2(int seed, const float* xs, const float* ys, const float* zs, const float* ws, float* noiseOut, int count)
+    {
+        int c = 0;
+        for (; c + 8 <= count; c += 8)
+        {
+            __m256 noise = Noise == NoiseType_Perlin ?
+                SinglePerlinAVX2(seed, _mm256_loadu_ps(xs + c), _mm256_loadu_ps(ys + c), _mm256_loadu_ps(zs + c), _mm256_loadu_ps(ws + c)) :
+                SingleOpenSimplex2AVX2(seed, _mm256_loadu_ps(xs + c), _mm256_loadu_ps(ys + c), _mm256_loadu_ps(zs + c), _mm256_loadu_ps(ws + c));
+            _mm256_storeu_ps(noiseOut + c, noise);
+        }
+
+        if (c < count)
+        {
+            float x[8] = {}, y[8] = {}, z[8] = {}, w[8] = {}, out[8];
+            for (int i = 0; i < count - c; i++)
+            {
+                x[i] = xs[c + i];
+                y[i] = ys[c + i];
+                z[i] = zs[c + i];
+                w[i] = ws[c + i];
+            }
+            __m256 noise = Noise == NoiseType_Perlin ?
+                SinglePerlinAVX2(seed, _mm256_loadu_ps(x), _mm256_loadu_ps(y), _mm256_loadu_ps(z), _mm256_loadu_ps(w)) :
+                SingleOpenSimplex2AVX2(seed, _mm256_loadu_ps(x), _mm256_loadu_ps(y), _mm256_loadu_ps(z), _mm256_loadu_ps(w));
+            _mm256_storeu_ps(out, noise);
+            for (int i = 0; i < count - c; i++)
+            {
+                noiseOut[c + i] = out[i];
+            }
+        }
+    }
+
+    void GenCellularChunkAVX2(int seed, const float* xs, const float* ys, const float* zs, float* noiseOut, int count)
+    {
+        // Euclidean and EuclideanSq only differ by the sqrt at the end, which the return type decides on
+        switch (mCellularDistanceFunction)
+        {
+        default:
+        case CellularDistanceFunction_Euclidean:
+            GenCellularChunkAVX2<CellularDistanceFunction_Euclidean>(seed, xs, ys, zs, noiseOut, count);
+            break;
+        case CellularDistanceFunction_EuclideanSq:
+            GenCellularChunkAVX2<CellularDistanceFunction_EuclideanSq>(seed, xs, ys, zs, noiseOut, count);
+            break;
+        case CellularDistanceFunction_Manhattan:
+            GenCellularChunkAVX2<CellularDistanceFunction_Manhattan>(seed, xs, ys, zs, noiseOut, count);
+            break;
+        case CellularDistanceFunction_Hybrid:
+            GenCellularChunkAVX2<CellularDistanceFunction_Hybrid>(seed, xs, ys, zs, noiseOut, count);
+            break;
+        }
+    }
+
+    template <CellularDistanceFunction Distance>
+    void GenCellularChunkAVX2(int seed, const float* xs, const float* ys, const float* zs, float* noiseOut, int count)
+    {
+        switch (mCellularReturnType)
+        {
+        default:
+        case CellularReturnType_CellValue:
+            GenCellularChunkAVX2<Distance, CellularReturnType_CellValue>(seed, xs, ys, zs, noiseOut, count);
+            break;
+        case CellularReturnType_Distance:
+            GenCellularChunkAVX2<Distance, CellularReturnType_Distance>(seed, xs, ys, zs, noiseOut, count);
+            break;
+        case CellularReturnType_Distance2:
+            GenCellularChunkAVX2<Distance, CellularReturnType_Distance2>(seed, xs, ys, zs, noiseOut, count);
+            break;
+        case CellularReturnType_Distance2Add:
+            GenCellularChunkAVX2<Distance, CellularReturnType_Distance2Add>(seed, xs, ys, zs, noiseOut, count);
+            break;
+        case CellularReturnType_Distance2Sub:
+            GenCellularChunkAVX2<Distance, CellularReturnType_Distance2Sub>(seed, xs, ys, zs, noiseOut, count);
+            break;
+        case CellularReturnType_Distance2Mul:
+            GenCellularChunkAVX2<Distance, CellularReturnType_Distance2Mul>(seed, xs, ys, zs, noiseOut, count);
+            break;
+        case CellularReturnType_Distance2Div:
+            GenCellularChunkAVX2<Distance, CellularReturnType_Distance2Div>(seed, xs, ys, zs, noiseOut, count);
+            break;
+        }
+    }
+
+    template <CellularDistanceFunction Distance, CellularReturnType Return>
+    FNL_TARGET_AVX2 void GenCellularChunkAVX2(int seed, const float* xs, const float* ys, const float* zs, float* noiseOut, int count)
+    {
+        float cellularJitter = 0.39614353f * mCellularJitterModifier;
+
+        int c = 0;
+        for (; c + 8 <= count; c += 8)
+        {
+            __m256 noise = SingleCellularAVX2<Distance, Return>(seed, cellularJitter, _mm256_loadu_ps(xs + c), _mm256_loadu_ps(ys + c), _mm256_loadu_ps(zs + c));
+            _mm256_storeu_ps(noiseOut + c, noise);
+        }
+
+        if (c < count)
+        {
+            float x[8] = {}, y[8] = {}, z[8] = {}, out[8];
+            for (int i = 0; i < count - c; i++)
+            {
+                x[i] = xs[c + i];
+                y[i] = ys[c + i];
+                z[i] = zs[c + i];
+            }
+            __m256 noise = SingleCellularAVX2<Distance, Return>(seed, cellularJitter, _mm256_loadu_ps(x), _mm256_loadu_ps(y), _mm256_loadu_ps(z));
+            _mm256_storeu_ps(out, noise);
+            for (int i = 0; i < count - c; i++)
+            {
+                noiseOut[c + i] = out[i];
+            }
+        }
+    }
+
+    void GenCellularChunkAVX2(int seed, const float* xs, const float* ys, const float* zs, const float* ws, float* noiseOut, int count)
+    {
+        switch (mCellularDistanceFunction)
+        {
+        default:
+        case CellularDistanceFunction_Euclidean:
+            GenCellularChunkAVX2<CellularDistanceFunction_Euclidean>(seed, xs, ys, zs, ws, noiseOut, count);
+            break;
+        case CellularDistanceFunction_EuclideanSq:
+            GenCellularChunkAVX2<CellularDistanceFunction_EuclideanSq>(seed, xs, ys, zs, ws, noiseOut, count);
+            break;
+        case CellularDistanceFunction_Manhattan:
+            GenCellularChunkAVX2<CellularDistanceFunction_Manhattan>(seed, xs, ys, zs, ws, noiseOut, count);
+            break;
+        case CellularDistanceFunction_Hybrid:
+            GenCellularChunkAVX2<CellularDistanceFunction_Hybrid>(seed, xs, ys, zs, ws, noiseOut, count);
+            break;
+        }
+    }
+
+    template <CellularDistanceFunction Distance>
+    void GenCellularChunkAVX2(int seed, const float* xs, const float* ys, const float* zs, const float* ws, float* noiseOut, int count)
+    {
+        switch (mCellularReturnType)
+        {
+        default:
+        case CellularReturnType_CellValue:
+            GenCellularChunkAVX2<Distance, CellularReturnType_CellValue>(seed, xs, ys, zs, ws, noiseOut, count);
+            break;
+        case CellularReturnType_Distance:
+            GenCellularChunkAVX2<Distance, CellularReturnType_Distance>(seed, xs, ys, zs, ws, noiseOut, count);
+            break;
+        case CellularReturnType_Distance2:
+            GenCellularChunkAVX2<Distance, CellularReturnType_Distance2>(seed, xs, ys, zs, ws, noiseOut, count);
+            break;
+        case CellularReturnType_Distance2Add:
+            GenCellularChunkAVX2<Distance, CellularReturnType_Distance2Add>(seed, xs, ys, zs, ws, noiseOut, count);
+            break;
+        case CellularReturnType_Distance2Sub:
+            GenCellularChunkAVX2<Distance, CellularReturnType_Distance2Sub>(seed, xs, ys, zs, ws, noiseOut, count);
+            break;
+        case CellularReturnType_Distance2Mul:
+            GenCellularChunkAVX2<Distance, CellularReturnType_Distance2Mul>(seed, xs, ys, zs, ws, noiseOut, count);
+            break;
+        case CellularReturnType_Distance2Div:
+            GenCellularChunkAVX2<Distance, CellularReturnType_Distance2Div>(seed, xs, ys, zs, ws, noiseOut, count);
+            break;
+        }
+    }
+
+    template <CellularDistanceFunction Distance, CellularReturnType Return>
+    FNL_TARGET_AVX2 void GenCellularChunkAVX2(int seed, const float* xs, const float* ys, const float* zs, const float* ws, float* noiseOut, int count)
+    {
+        float cellularJitter = 0.36602540f * mCellularJitterModifier;
+
+        int c = 0;
+        for (; c + 8 <= count; c += 8)
+        {
+            __m256 noise = SingleCellularAVX2<Distance, Return>(seed, cellularJitter, _mm256_loadu_ps(xs + c), _mm256_loadu_ps(ys + c), _mm256_loadu_ps(zs + c), _mm256_loadu_ps(ws + c));
+            _mm256_storeu_ps(noiseOut + c, noise);
+        }
+
+        if (c < count)
+        {
+            float x[8] = {}, y[8] = {}, z[8] = {}, w[8] = {}, out[8];
+            for (int i = 0; i < count - c; i++)
+            {
+                x[i] = xs[c + i];
+                y[i] = ys[c + i];
+                z[i] = zs[c + i];
+                w[i] = ws[c + i];
+            }
+            __m256 noise = SingleCellularAVX2<Distance, Return>(seed, cellularJitter, _mm256_loadu_ps(x), _mm256_loadu_ps(y), _mm256_loadu_ps(z), _mm256_loadu_ps(w));
+            _mm256_storeu_ps(out, noise);
+            for (int i = 0; i < count - c; i++)
+            {
+                noiseOut[c + i] = out[i];
+            }
+        }
+    }
+
+    static FNL_TARGET_AVX2 __m256i FastFloorAVX2(__m256 f)
+    {
+        __m256i truncated = _mm256_cvttps_epi32(f);
+        __m256i negative = _mm256_castps_si256(_mm256_cmp_ps(f, _mm256_setzero_ps(), _CMP_LT_OQ));
+        return _mm256_add_epi32(truncated, negative);
+    }
+
+    static FNL_TARGET_AVX2 __m256i FastRoundAVX2(__m256 f)
+    {
+        __m256 half = _mm256_blendv_ps(_mm256_set1_ps(0.5f), _mm256_set1_ps(-0.5f), _mm256_cmp_ps(f, _mm256_setzero_ps(), _CMP_LT_OQ));
+        return _mm256_cvttps_epi32(_mm256_add_ps(f, half));
+    }
+
+    static FNL_TARGET_AVX2 __m256 InterpQuinticAVX2(__m256 t)
+    {
+        __m256 ttt = _mm256_mul_ps(_mm256_mul_ps(t, t), t);
+        __m256 inner = _mm256_sub_ps(_mm256_mul_ps(t, _mm256_set1_ps(6)), _mm256_set1_ps(15));
+        return _mm256_mul_ps(ttt, _mm256_add_ps(_mm256_mul_ps(t, inner), _mm256_set1_ps(10)));
+    }
+
+    static FNL_TARGET_AVX2 __m256 LerpAVX2(__m256 a, __m256 b, __m256 t)
+    {
+        return _mm256_add_ps(a, _mm256_mul_ps(t, _mm256_sub_ps(b, a)));
+    }
+
+    static FNL_TARGET_AVX2 __m256 GradCoordAVX2(__m256i seed, __m256i xPrimed, __m256i yPrimed, __m256i zPrimed, __m256 xd, __m256 yd, __m256 zd)
+    {
+        __m256i hash = _mm256_xor_si256(_mm256_xor_si256(seed, xPrimed), _mm256_xor_si256(yPrimed, zPrimed));
+        hash = _mm256_mullo_epi32(hash, _mm256_set1_epi32(0x27d4eb2d));
+        hash = _mm256_xor_si256(hash, _mm256_srai_epi32(hash, 15));
+        hash = _mm256_and_si256(hash, _mm256_set1_epi32(63 << 2));
+
+        __m256 xg = _mm256_i32gather_ps(Lookup<float>::Gradients3D, hash, 4);
+        __m256 yg = _mm256_i32gather_ps(Lookup<float>::Gradients3D + 1, hash, 4);
+        __m256 zg = _mm256_i32gather_ps(Lookup<float>::Gradients3D + 2, hash, 4);
+
+        return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(xd, xg), _mm256_mul_ps(yd, yg)), _mm256_mul_ps(zd, zg));
+    }
+
+    static FNL_TARGET_AVX2 __m256 GradCoordAVX2(__m256i seed, __m256i xPrimed, __m256i yPrimed, __m256i zPrimed, __m256i wPrimed, __m256 xd, __m256 yd, __m256 zd, __m256 wd)
+    {
+        __m256i hash = _mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(seed, xPrimed), _mm256_xor_si256(yPrimed, zPrimed)), wPrimed);
+        hash = _mm256_mullo_epi32(hash, _mm256_set1_epi32(0x27d4eb2d));
+        hash = _mm256_xor_si256(hash, _mm256_srai_epi32(hash, 15));
+        hash = _mm256_and_si256(hash, _mm256_set1_epi32(63 << 2));
+
+        __m256 xg = _mm256_i32gather_ps(Lookup<float>::Gradients4D, hash, 4);
+        __m256 yg = _mm256_i32gather_ps(Lookup<float>::Gradients4D + 1, hash, 4);
+        __m256 zg = _mm256_i32gather_ps(Lookup<float>::Gradients4D + 2, hash, 4);
+        __m256 wg = _mm256_i32gather_ps(Lookup<float>::Gradients4D + 3, hash, 4);
+
+        return _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(xd, xg), _mm256_mul_ps(yd, yg)), _mm256_mul_ps(zd, zg)), _mm256_mul_ps(wd, wg));
+    }
+
+    FNL_TARGET_AVX2 __m256 SinglePerlinAVX2(int seed, __m256 x, __m256 y, __m256 z)
+    {
+        __m256i x0 = FastFloorAVX2(x);
+        __m256i y0 = FastFloorAVX2(y);
+        __m256i z0 = FastFloorAVX2(z);
+
+        __m256 one = _mm256_set1_ps(1);
+        __m256 xd0 = _mm256_sub_ps(x, _mm256_cvtepi32_ps(x0));
+        __m256 yd0 = _mm256_sub_ps(y, _mm256_cvtepi32_ps(y0));
+        __m256 zd0 = _mm256_sub_ps(z, _mm256_cvtepi32_ps(z0));
+        __m256 xd1 = _mm256_sub_ps(xd0, one);
+        __m256 yd1 = _mm256_sub_ps(yd0, one);
+        __m256 zd1 = _mm256_sub_ps(zd0, one);
+
+        __m256 xs = InterpQuinticAVX2(xd0);
+        __m256 ys = InterpQuinticAVX2(yd0);
+        __m256 zs = InterpQuinticAVX2(zd0);
+
+        x0 = _mm256_mullo_epi32(x0, _mm256_set1_epi32(PrimeX));
+        y0 = _mm256_mullo_epi32(y0, _mm256_set1_epi32(PrimeY));
+        z0 = _mm256_mullo_epi32(z0, _mm256_set1_epi32(PrimeZ));
+        __m256i x1 = _mm256_add_epi32(x0, _mm256_set1_epi32(PrimeX));
+        __m256i y1 = _mm256_add_epi32(y0, _mm256_set1_epi32(PrimeY));
+        __m256i z1 = _mm256_add_epi32(z0, _mm256_set1_epi32(PrimeZ));
+
+        __m256i s = _mm256_set1_epi32(seed);
+        __m256 xf00 = LerpAVX2(GradCoordAVX2(s, x0, y0, z0, xd0, yd0, zd0), GradCoordAVX2(s, x1, y0, z0, xd1, yd0, zd0), xs);
+        __m256 xf10 = LerpAVX2(GradCoordAVX2(s, x0, y1, z0, xd0, yd1, zd0), GradCoordAVX2(s, x1, y1, z0, xd1, yd1, zd0), xs);
+        __m256 xf01 = LerpAVX2(GradCoordAVX2(s, x0, y0, z1, xd0, yd0, zd1), GradCoordAVX2(s, x1, y0, z1, xd1, yd0, zd1), xs);
+        __m256 xf11 = LerpAVX2(GradCoordAVX2(s, x0, y1, z1, xd0, yd1, zd1), GradCoordAVX2(s, x1, y1, z1, xd1, yd1, zd1), xs);
+
+        __m256 yf0 = LerpAVX2(xf00, xf10, ys);
+        __m256 yf1 = LerpAVX2(xf01, xf11, ys);
+
+        return _mm256_mul_ps(LerpAVX2(yf0, yf1, zs), _mm256_set1_ps(0.964921414852142333984375f));
+    }
+
+    FNL_TARGET_AVX2 __m256 SinglePerlinAVX2(int seed, __m256 x, __m256 y, __m256 z, __m256 w)
+    {
+        __m256i x0 = FastFloorAVX2(x);
+        __m256i y0 = FastFloorAVX2(y);
+        __m256i z0 = FastFloorAVX2(z);
+        __m256i w0 = FastFloorAVX2(w);
+
+        __m256 one = _mm256_set1_ps(1);
+        __m256 xd0 = _mm256_sub_ps(x, _mm256_cvtepi32_ps(x0));
+        __m256 yd0 = _mm256_sub_ps(y, _mm256_cvtepi32_ps(y0));
+        __m256 zd0 = _mm256_sub_ps(z, _mm256_cvtepi32_ps(z0));
+        __m256 wd0 = _mm256_sub_ps(w, _mm256_cvtepi32_ps(w0));
+        __m256 xd1 = _mm256_sub_ps(xd0, one);
+        __m256 yd1 = _mm256_sub_ps(yd0, one);
+        __m256 zd1 = _mm256_sub_ps(zd0, one);
+        __m256 wd1 = _mm256_sub_ps(wd0, one);
+
+        __m256 xs = InterpQuinticAVX2(xd0);
+        __m256 ys = InterpQuinticAVX2(yd0);
+        __m256 zs = InterpQuinticAVX2(zd0);
+        __m256 ws = InterpQuinticAVX2(wd0);
+
+        x0 = _mm256_mullo_epi32(x0, _mm256_set1_epi32(PrimeX));
+        y0 = _mm256_mullo_epi32(y0, _mm256_set1_epi32(PrimeY));
+        z0 = _mm256_mullo_epi32(z0, _mm256_set1_epi32(PrimeZ));
+        w0 = _mm256_mullo_epi32(w0, _mm256_set1_epi32(PrimeW));
+        __m256i x1 = _mm256_add_epi32(x0, _mm256_set1_epi32(PrimeX));
+        __m256i y1 = _mm256_add_epi32(y0, _mm256_set1_epi32(PrimeY));
+        __m256i z1 = _mm256_add_epi32(z0, _mm256_set1_epi32(PrimeZ));
+        __m256i w1 = _mm256_add_epi32(w0, _mm256_set1_epi32(PrimeW));
+
+        __m256i s = _mm256_set1_epi32(seed);
+        __m256 xf000 = LerpAVX2(GradCoordAVX2(s, x0, y0, z0, w0, xd0, yd0, zd0, wd0), GradCoordAVX2(s, x1, y0, z0, w0, xd1, yd0, zd0, wd0), xs);
+        __m256 xf100 = LerpAVX2(GradCoordAVX2(s, x0, y1, z0, w0, xd0, yd1, zd0, wd0), GradCoordAVX2(s, x1, y1, z0, w0, xd1, yd1, zd0, wd0), xs);
+        __m256 xf010 = LerpAVX2(GradCoordAVX2(s, x0, y0, z1, w0, xd0, yd0, zd1, wd0), GradCoordAVX2(s, x1, y0, z1, w0, xd1, yd0, zd1, wd0), xs);
+        __m256 xf110 = LerpAVX2(GradCoordAVX2(s, x0, y1, z1, w0, xd0, yd1, zd1, wd0), GradCoordAVX2(s, x1, y1, z1, w0, xd1, yd1, zd1, wd0), xs);
+        __m256 xf001 = LerpAVX2(GradCoordAVX2(s, x0, y0, z0, w1, xd0, yd0, zd0, wd1), GradCoordAVX2(s, x1, y0, z0, w1, xd1, yd0, zd0, wd1), xs);
+        __m256 xf101 = LerpAVX2(GradCoordAVX2(s, x0, y1, z0, w1, xd0, yd1, zd0, wd1), GradCoordAVX2(s, x1, y1, z0, w1, xd1, yd1, zd0, wd1), xs);
+        __m256 xf011 = LerpAVX2(GradCoordAVX2(s, x0, y0, z1, w1, xd0, yd0, zd1, wd1), GradCoordAVX2(s, x1, y0, z1, w1, xd1, yd0, zd1, wd1), xs);
+        __m256 xf111 = LerpAVX2(GradCoordAVX2(s, x0, y1, z1, w1, xd0, yd1, zd1, wd1), GradCoordAVX2(s, x1, y1, z1, w1, xd1, yd1, zd1, wd1), xs);
+
+        __m256 yf00 = LerpAVX2(xf000, xf100, ys);
+        __m256 yf10 = LerpAVX2(xf010, xf110, ys);
+        __m256 yf01 = LerpAVX2(xf001, xf101, ys);
+        __m256 yf11 = LerpAVX2(xf011, xf111, ys);
+
+        __m256 zf0 = LerpAVX2(yf00, yf10, zs);
+        __m256 zf1 = LerpAVX2(yf01, yf11, zs);
+
+        return _mm256_mul_ps(LerpAVX2(zf0, zf1, ws), _mm256_set1_ps(0.797474f));
+    }
+
+    FNL_TARGET_AVX2 __m256 SingleOpenSimplex2AVX2(int seed, __m256 x, __m256 y, __m256 z)
+    {
+        __m256i i = FastRoundAVX2(x);
+        __m256i j = FastRoundAVX2(y);
+        __m256i k = FastRoundAVX2(z);
+        __m256 x0 = _mm256_sub_ps(x, _mm256_cvtepi32_ps(i));
+        __m256 y0 = _mm256_sub_ps(y, _mm256_cvtepi32_ps(j));
+        __m256 z0 = _mm256_sub_ps(z, _mm256_cvtepi32_ps(k));
+
+        __m256 minusOne = _mm256_set1_ps(-1.0f);
+        __m256i oneI = _mm256_set1_epi32(1);
+        __m256i xNSign = _mm256_or_si256(_mm256_cvttps_epi32(_mm256_sub_ps(minusOne, x0)), oneI);
+        __m256i yNSign = _mm256_or_si256(_mm256_cvttps_epi32(_mm256_sub_ps(minusOne, y0)), oneI);
+        __m256i zNSign = _mm256_or_si256(_mm256_cvttps_epi32(_mm256_sub_ps(minusOne, z0)), oneI);
+
+        __m256 zero = _mm256_setzero_ps();
+        __m256 ax0 = _mm256_mul_ps(_mm256_cvtepi32_ps(xNSign), _mm256_sub_ps(zero, x0));
+        __m256 ay0 = _mm256_mul_ps(_mm256_cvtepi32_ps(yNSign), _mm256_sub_ps(zero, y0));
+        __m256 az0 = _mm256_mul_ps(_mm256_cvtepi32_ps(zNSign), _mm256_sub_ps(zero, z0));
+
+        __m256i primeX = _mm256_set1_epi32(PrimeX);
+        __m256i primeY = _mm256_set1_epi32(PrimeY);
+        __m256i primeZ = _mm256_set1_epi32(PrimeZ);
+        i = _mm256_mullo_epi32(i, primeX);
+        j = _mm256_mullo_epi32(j, primeY);
+        k = _mm256_mullo_epi32(k, primeZ);
+
+        __m256 value = zero;
+        __m256 a = _mm256_sub_ps(_mm256_sub_ps(_mm256_set1_ps(0.6f), _mm256_mul_ps(x0, x0)), _mm256_add_ps(_mm256_mul_ps(y0, y0), _mm256_mul_ps(z0, z0)));
+
+        for (int l = 0; ; l++)
+        {
+            __m256i s = _mm256_set1_epi32(seed);
+            __m256 aa = _mm256_mul_ps(a, a);
+            __m256 contribA = _mm256_mul_ps(_mm256_mul_ps(aa, aa), GradCoordAVX2(s, i, j, k, x0, y0, z0));
+            value = _mm256_add_ps(value, _mm256_and_ps(contribA, _mm256_cmp_ps(a, zero, _CMP_GT_OQ)));
+
+            // Pick the axis to step along, same tie breaking as the scalar if/else chain
+            __m256 useX = _mm256_and_ps(_mm256_cmp_ps(ax0, ay0, _CMP_GE_OQ), _mm256_cmp_ps(ax0, az0, _CMP_GE_OQ));
+            __m256 useY = _mm256_andnot_ps(useX, _mm256_and_ps(_mm256_cmp_ps(ay0, ax0, _CMP_GT_OQ), _mm256_cmp_ps(ay0, az0, _CMP_GE_OQ)));
+            __m256 useZ = _mm256_andnot_ps(_mm256_or_ps(useX, useY), _mm256_castsi256_ps(_mm256_set1_epi32(-1)));
+
+            __m256 xSignF = _mm256_cvtepi32_ps(xNSign);
+            __m256 ySignF = _mm256_cvtepi32_ps(yNSign);
+            __m256 zSignF = _mm256_cvtepi32_ps(zNSign);
+
+            __m256 x1 = _mm256_add_ps(x0, _mm256_and_ps(xSignF, useX));
+            __m256 y1 = _mm256_add_ps(y0, _mm256_and_ps(ySignF, useY));
+            __m256 z1 = _mm256_add_ps(z0, _mm256_and_ps(zSignF, useZ));
+
+            __m256 two = _mm256_set1_ps(2);
+            __m256 bStep = _mm256_blendv_ps(
+                _mm256_blendv_ps(_mm256_mul_ps(_mm256_mul_ps(zSignF, two), z1), _mm256_mul_ps(_mm256_mul_ps(ySignF, two), y1), useY),
+                _mm256_mul_ps(_mm256_mul_ps(xSignF, two), x1), useX);
+            __m256 b = _mm256_sub_ps(_mm256_add_ps(a, _mm256_set1_ps(1)), bStep);
+
+            __m256i i1 = _mm256_sub_epi32(i, _mm256_and_si256(_mm256_mullo_epi32(xNSign, primeX), _mm256_castps_si256(useX)));
+            __m256i j1 = _mm256_sub_epi32(j, _mm256_and_si256(_mm256_mullo_epi32(yNSign, primeY), _mm256_castps_si256(useY)));
+            __m256i k1 = _mm256_sub_epi32(k, _mm256_and_si256(_mm256_mullo_epi32(zNSign, primeZ), _mm256_castps_si256(useZ)));
+
+            __m256 bb = _mm256_mul_ps(b, b);
+            __m256 contribB = _mm256_mul_ps(_mm256_mul_ps(bb, bb), GradCoordAVX2(s, i1, j1, k1, x1, y1, z1));
+            value = _mm256_add_ps(value, _mm256_and_ps(contribB, _mm256_cmp_ps(b, zero, _CMP_GT_OQ)));
+
+            if (l == 1) break;
+
+            __m256 half = _mm256_set1_ps(0.5f);
+            ax0 = _mm256_sub_ps(half, ax0);
+            ay0 = _mm256_sub_ps(half, ay0);
+            az0 = _mm256_sub_ps(half, az0);
+
+            x0 = _mm256_mul_ps(xSignF, ax0);
+            y0 = _mm256_mul_ps(ySignF, ay0);
+            z0 = _mm256_mul_ps(zSignF, az0);
+
+            a = _mm256_add_ps(a, _mm256_sub_ps(_mm256_sub_ps(_mm256_set1_ps(0.75f), ax0), _mm256_add_ps(ay0, az0)));
+
+            i = _mm256_add_epi32(i, _mm256_and_si256(_mm256_srai_epi32(xNSign, 1), primeX));
+            j = _mm256_add_epi32(j, _mm256_and_si256(_mm256_srai_epi32(yNSign, 1), primeY));
+            k = _mm256_add_epi32(k, _mm256_and_si256(_mm256_srai_epi32(zNSign, 1), primeZ));
+
+            xNSign = _mm256_sub_epi32(_mm256_setzero_si256(), xNSign);
+            yNSign = _mm256_sub_epi32(_mm256_setzero_si256(), yNSign);
+            zNSign = _mm256_sub_epi32(_mm256_setzero_si256(), zNSign);
+
+            seed = ~seed;
+        }
+
+        return _mm256_mul_ps(value, _mm256_set1_ps(32.69428253173828125f));
+    }
+
+    FNL_TARGET_AVX2 __m256 SingleOpenSimplex2AVX2(int seed, __m256 x, __m256 y, __m256 z, __m256 w)
+    {
+        const float SQRT5 = 2.2360679774997896964091736687313f;
+        const float G4 = (5 - SQRT5) / 20;
+
+        __m256i i = FastFloorAVX2(x);
+        __m256i j = FastFloorAVX2(y);
+        __m256i k = FastFloorAVX2(z);
+        __m256i l = FastFloorAVX2(w);
+        __m256 xi = _mm256_sub_ps(x, _mm256_cvtepi32_ps(i));
+        __m256 yi = _mm256_sub_ps(y, _mm256_cvtepi32_ps(j));
+        __m256 zi = _mm256_sub_ps(z, _mm256_cvtepi32_ps(k));
+        __m256 wi = _mm256_sub_ps(w, _mm256_cvtepi32_ps(l));
+
+        __m256 t = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_add_ps(xi, yi), zi), wi), _mm256_set1_ps(G4));
+        __m256 x0 = _mm256_sub_ps(xi, t);
+        __m256 y0 = _mm256_sub_ps(yi, t);
+        __m256 z0 = _mm256_sub_ps(zi, t);
+        __m256 w0 = _mm256_sub_ps(wi, t);
+
+        // Rank the axes from the six comparisons, a true compare is -1 so a lost one counts as 1 + compare
+        __m256i xy = _mm256_castps_si256(_mm256_cmp_ps(x0, y0, _CMP_GT_OQ));
+        __m256i xz = _mm256_castps_si256(_mm256_cmp_ps(x0, z0, _CMP_GT_OQ));
+        __m256i xw = _mm256_castps_si256(_mm256_cmp_ps(x0, w0, _CMP_GT_OQ));
+        __m256i yz = _mm256_castps_si256(_mm256_cmp_ps(y0, z0, _CMP_GT_OQ));
+        __m256i yw = _mm256_castps_si256(_mm256_cmp_ps(y0, w0, _CMP_GT_OQ));
+        __m256i zw = _mm256_castps_si256(_mm256_cmp_ps(z0, w0, _CMP_GT_OQ));
+        __m256i zeroI = _mm256_setzero_si256();
+        __m256i rankX = _mm256_sub_epi32(_mm256_sub_epi32(_mm256_sub_epi32(zeroI, xy), xz), xw);
+        __m256i rankY = _mm256_sub_epi32(_mm256_sub_epi32(_mm256_add_epi32(_mm256_set1_epi32(1), xy), yz), yw);
+        __m256i rankZ = _mm256_sub_epi32(_mm256_add_epi32(_mm256_add_epi32(_mm256_set1_epi32(2), xz), yz), zw);
+        __m256i rankW = _mm256_add_epi32(_mm256_add_epi32(_mm256_add_epi32(_mm256_set1_epi32(3), xw), yw), zw);
+
+        __m256i primeX = _mm256_set1_epi32(PrimeX);
+        __m256i primeY = _mm256_set1_epi32(PrimeY);
+        __m256i primeZ = _mm256_set1_epi32(PrimeZ);
+        __m256i primeW = _mm256_set1_epi32(PrimeW);
+        i = _mm256_mullo_epi32(i, primeX);
+        j = _mm256_mullo_epi32(j, primeY);
+        k = _mm256_mullo_epi32(k, primeZ);
+        l = _mm256_mullo_epi32(l, primeW);
+
+        __m256i s = _mm256_set1_epi32(seed);
+        __m256 zero = _mm256_setzero_ps();
+        __m256 falloff = _mm256_set1_ps(0.6f);
+        __m256 value = zero;
+
+        // All five vertices are always evaluated, the ones outside the falloff are masked out
+        for (int n = 0; n < 5; n++)
+        {
+            __m256i rankMin = _mm256_set1_epi32(3 - n);
+            __m256i xMask = n == 4 ? _mm256_set1_epi32(-1) : _mm256_cmpgt_epi32(rankX, rankMin);
+            __m256i yMask = n == 4 ? _mm256_set1_epi32(-1) : _mm256_cmpgt_epi32(rankY, rankMin);
+            __m256i zMask = n == 4 ? _mm256_set1_epi32(-1) : _mm256_cmpgt_epi32(rankZ, rankMin);
+            __m256i wMask = n == 4 ? _mm256_set1_epi32(-1) : _mm256_cmpgt_epi32(rankW, rankMin);
+
+            __m256 offset = _mm256_set1_ps(n * G4);
+            __m256 xn = _mm256_add_ps(_mm256_add_ps(x0, _mm256_cvtepi32_ps(xMask)), offset);
+            __m256 yn = _mm256_add_ps(_mm256_add_ps(y0, _mm256_cvtepi32_ps(yMask)), offset);
+            __m256 zn = _mm256_add_ps(_mm256_add_ps(z0, _mm256_cvtepi32_ps(zMask)), offset);
+            __m256 wn = _mm256_add_ps(_mm256_add_ps(w0, _mm256_cvtepi32_ps(wMask)), offset);
+
+            __m256 an = _mm256_sub_ps(_mm256_sub_ps(_mm256_sub_ps(_mm256_sub_ps(falloff, _mm256_mul_ps(xn, xn)), _mm256_mul_ps(yn, yn)), _mm256_mul_ps(zn, zn)), _mm256_mul_ps(wn, wn));
+            __m256 aa = _mm256_mul_ps(an, an);
+            __m256 contrib = _mm256_mul_ps(_mm256_mul_ps(aa, aa), GradCoordAVX2(s,
+                _mm256_add_epi32(i, _mm256_and_si256(xMask, primeX)), _mm256_add_epi32(j, _mm256_and_si256(yMask, primeY)),
+                _mm256_add_epi32(k, _mm256_and_si256(zMask, primeZ)), _mm256_add_epi32(l, _mm256_and_si256(wMask, primeW)), xn, yn, zn, wn));
+            value = _mm256_add_ps(value, _mm256_and_ps(contrib, _mm256_cmp_ps(an, zero, _CMP_GT_OQ)));
+        }
+
+        return _mm256_mul_ps(value, _mm256_set1_ps(27.2256f));
+    }
+
+    template <CellularDistanceFunction Distance, CellularReturnType Return>
+    static FNL_TARGET_AVX2 __m256 SingleCellularAVX2(int seed, float cellularJitter, __m256 x, __m256 y, __m256 z)
+    {
+        __m256i xr = FastRoundAVX2(x);
+        __m256i yr = FastRoundAVX2(y);
+        __m256i zr = FastRoundAVX2(z);
+
+        __m256 distance0 = _mm256_set1_ps(1e10f);
+        __m256 distance1 = _mm256_set1_ps(1e10f);
+        __m256i closestHash = _mm256_setzero_si256();
+
+        __m256i s = _mm256_set1_epi32(seed);
+        __m256 jitter = _mm256_set1_ps(cellularJitter);
+        __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+        __m256i oneI = _mm256_set1_epi32(1);
+
+        __m256i xi = _mm256_sub_epi32(xr, oneI);
+        __m256i xPrimed = _mm256_mullo_epi32(xi, _mm256_set1_epi32(PrimeX));
+        __m256i yPrimedBase = _mm256_mullo_epi32(_mm256_sub_epi32(yr, oneI), _mm256_set1_epi32(PrimeY));
+        __m256i zPrimedBase = _mm256_mullo_epi32(_mm256_sub_epi32(zr, oneI), _mm256_set1_epi32(PrimeZ));
+
+        // All 27 cells are always visited, the nearest two are tracked with min/max and blends
+        for (int xOffset = 0; xOffset < 3; xOffset++)
+        {
+            __m256 xCell = _mm256_sub_ps(_mm256_cvtepi32_ps(xi), x);
+            __m256i yi = _mm256_sub_epi32(yr, oneI);
+            __m256i yPrimed = yPrimedBase;
+
+            for (int yOffset = 0; yOffset < 3; yOffset++)
+            {
+                __m256 yCell = _mm256_sub_ps(_mm256_cvtepi32_ps(yi), y);
+                __m256i zi = _mm256_sub_epi32(zr, oneI);
+                __m256i zPrimed = zPrimedBase;
+
+                for (int zOffset = 0; zOffset < 3; zOffset++)
+                {
+                    __m256i hash = _mm256_xor_si256(_mm256_xor_si256(s, xPrimed), _mm256_xor_si256(yPrimed, zPrimed));
+                    hash = _mm256_mullo_epi32(hash, _mm256_set1_epi32(0x27d4eb2d));
+                    __m256i idx = _mm256_and_si256(hash, _mm256_set1_epi32(255 << 2));
+
+                    __m256 vecX = _mm256_add_ps(xCell, _mm256_mul_ps(_mm256_i32gather_ps(Lookup<float>::RandVecs3D, idx, 4), jitter));
+                    __m256 vecY = _mm256_add_ps(yCell, _mm256_mul_ps(_mm256_i32gather_ps(Lookup<float>::RandVecs3D + 1, idx, 4), jitter));
+                    __m256 vecZ = _mm256_add_ps(_mm256_sub_ps(_mm256_cvtepi32_ps(zi), z), _mm256_mul_ps(_mm256_i32gather_ps(Lookup<float>::RandVecs3D + 2, idx, 4), jitter));
+
+                    __m256 newDistance;
+                    __m256 euclidean = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vecX, vecX), _mm256_mul_ps(vecY, vecY)), _mm256_mul_ps(vecZ, vecZ));
+                    __m256 manhattan = _mm256_add_ps(_mm256_add_ps(_mm256_and_ps(vecX, absMask), _mm256_and_ps(vecY, absMask)), _mm256_and_ps(vecZ, absMask));
+                    switch (Distance)
+                    {
+                    default:
+                        newDistance = euclidean;
+                        break;
+                    case CellularDistanceFunction_Manhattan:
+                        newDistance = manhattan;
+                        break;
+                    case CellularDistanceFunction_Hybrid:
+                        newDistance = _mm256_add_ps(manhattan, euclidean);
+                        break;
+                    }
+
+                    distance1 = _mm256_max_ps(_mm256_min_ps(distance1, newDistance), distance0);
+                    __m256 closer = _mm256_cmp_ps(newDistance, distance0, _CMP_LT_OQ);
+                    distance0 = _mm256_blendv_ps(distance0, newDistance, closer);
+                    if (Return == CellularReturnType_CellValue)
+                    {
+                        closestHash = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(closestHash), _mm256_castsi256_ps(hash), closer));
+                    }
+
+                    zi = _mm256_add_epi32(zi, oneI);
+                    zPrimed = _mm256_add_epi32(zPrimed, _mm256_set1_epi32(PrimeZ));
+                }
+                yi = _mm256_add_epi32(yi, oneI);
+                yPrimed = _mm256_add_epi32(yPrimed, _mm256_set1_epi32(PrimeY));
+            }
+            xi = _mm256_add_epi32(xi, oneI);
+            xPrimed = _mm256_add_epi32(xPrimed, _mm256_set1_epi32(PrimeX));
+        }
+
+        return CellularReturnAVX2<Distance, Return>(distance0, distance1, closestHash);
+    }
+
+    template <CellularDistanceFunction Distance, CellularReturnType Return>
+    static FNL_TARGET_AVX2 __m256 SingleCellularAVX2(int seed, float cellularJitter, __m256 x, __m256 y, __m256 z, __m256 w)
+    {
+        __m256i xr = FastRoundAVX2(x);
+        __m256i yr = FastRoundAVX2(y);
+        __m256i zr = FastRoundAVX2(z);
+        __m256i wr = FastRoundAVX2(w);
+
+        __m256 distance0 = _mm256_set1_ps(1e10f);
+        __m256 distance1 = _mm256_set1_ps(1e10f);
+        __m256i closestHash = _mm256_setzero_si256();
+
+        __m256i s = _mm256_set1_epi32(seed);
+        __m256 jitter = _mm256_set1_ps(cellularJitter);
+        __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+        __m256i oneI = _mm256_set1_epi32(1);
+
+        __m256i xi = _mm256_sub_epi32(xr, oneI);
+        __m256i xPrimed = _mm256_mullo_epi32(xi, _mm256_set1_epi32(PrimeX));
+        __m256i yPrimedBase = _mm256_mullo_epi32(_mm256_sub_epi32(yr, oneI), _mm256_set1_epi32(PrimeY));
+        __m256i zPrimedBase = _mm256_mullo_epi32(_mm256_sub_epi32(zr, oneI), _mm256_set1_epi32(PrimeZ));
+        __m256i wPrimedBase = _mm256_mullo_epi32(_mm256_sub_epi32(wr, oneI), _mm256_set1_epi32(PrimeW));
+
+        // All 81 cells are always visited, the nearest two are tracked with min/max and blends
+        for (int xOffset = 0; xOffset < 3; xOffset++)
+        {
+            __m256 xCell = _mm256_sub_ps(_mm256_cvtepi32_ps(xi), x);
+            __m256i yi = _mm256_sub_epi32(yr, oneI);
+            __m256i yPrimed = yPrimedBase;
+
+            for (int yOffset = 0; yOffset < 3; yOffset++)
+            {
+                __m256 yCell = _mm256_sub_ps(_mm256_cvtepi32_ps(yi), y);
+                __m256i xyHash = _mm256_xor_si256(_mm256_xor_si256(s, xPrimed), yPrimed);
+                __m256i zi = _mm256_sub_epi32(zr, oneI);
+                __m256i zPrimed = zPrimedBase;
+
+                for (int zOffset = 0; zOffset < 3; zOffset++)
+                {
+                    __m256 zCell = _mm256_sub_ps(_mm256_cvtepi32_ps(zi), z);
+                    __m256i xyzHash = _mm256_xor_si256(xyHash, zPrimed);
+                    __m256i wi = _mm256_sub_epi32(wr, oneI);
+                    __m256i wPrimed = wPrimedBase;
+
+                    for (int wOffset = 0; wOffset < 3; wOffset++)
+                    {
+                        __m256i hash = _mm256_mullo_epi32(_mm256_xor_si256(xyzHash, wPrimed), _mm256_set1_epi32(0x27d4eb2d));
+                        __m256i idx = _mm256_and_si256(hash, _mm256_set1_epi32(255 << 2));
+
+                        __m256 vecX = _mm256_add_ps(xCell, _mm256_mul_ps(_mm256_i32gather_ps(Lookup<float>::RandVecs4D, idx, 4), jitter));
+                        __m256 vecY = _mm256_add_ps(yCell, _mm256_mul_ps(_mm256_i32gather_ps(Lookup<float>::RandVecs4D + 1, idx, 4), jitter));
+                        __m256 vecZ = _mm256_add_ps(zCell, _mm256_mul_ps(_mm256_i32gather_ps(Lookup<float>::RandVecs4D + 2, idx, 4), jitter));
+                        __m256 vecW = _mm256_add_ps(_mm256_sub_ps(_mm256_cvtepi32_ps(wi), w), _mm256_mul_ps(_mm256_i32gather_ps(Lookup<float>::RandVecs4D + 3, idx, 4), jitter));
+
+                        __m256 newDistance;
+                        __m256 euclidean = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vecX, vecX), _mm256_mul_ps(vecY, vecY)), _mm256_mul_ps(vecZ, vecZ)), _mm256_mul_ps(vecW, vecW));
+                        __m256 manhattan = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_and_ps(vecX, absMask), _mm256_and_ps(vecY, absMask)), _mm256_and_ps(vecZ, absMask)), _mm256_and_ps(vecW, absMask));
+                        switch (Distance)
+                        {
+                        default:
+                            newDistance = euclidean;
+                            break;
+                        case CellularDistanceFunction_Manhattan:
+                            newDistance = manhattan;
+                            break;
+                        case CellularDistanceFunction_Hybrid:
+                            newDistance = _mm256_add_ps(manhattan, euclidean);
+                            break;
+                        }
+
+                        distance1 = _mm256_max_ps(_mm256_min_ps(distance1, newDistance), distance0);
+                        __m256 closer = _mm256_cmp_ps(newDistance, distance0, _CMP_LT_OQ);
+                        distance0 = _mm256_blendv_ps(distance0, newDistance, closer);
+                        if (Return == CellularReturnType_CellValue)
+                        {
+                            closestHash = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(closestHash), _mm256_castsi256_ps(hash), closer));
+                        }
+
+                        wi = _mm256_add_epi32(wi, oneI);
+                        wPrimed = _mm256_add_epi32(wPrimed, _mm256_set1_epi32(PrimeW));
+                    }
+                    zi = _mm256_add_epi32(zi, oneI);
+                    zPrimed = _mm256_add_epi32(zPrimed, _mm256_set1_epi32(PrimeZ));
+                }
+                yi = _mm256_add_epi32(yi, oneI);
+                yPrimed = _mm256_add_epi32(yPrimed, _mm256_set1_epi32(PrimeY));
+            }
+            xi = _mm256_add_epi32(xi, oneI);
+            xPrimed = _mm256_add_epi32(xPrimed, _mm256_set1_epi32(PrimeX));
+        }
+
+        return CellularReturnAVX2<Distance, Return>(distance0, distance1, closestHash);
+    }
+
+    // Turns the two nearest distances into the output the same way for 3D and 4D
+    template <CellularDistanceFunction Distance, CellularReturnType Return>
+    static FNL_TARGET_AVX2 __m256 CellularReturnAVX2(__m256 distance0, __m256 distance1, __m256i closestHash)
+    {
+        if (Distance == CellularDistanceFunction_Euclidean && Return >= CellularReturnType_Distance)
+        {
+            distance0 = _mm256_sqrt_ps(distance0);
+
+            if (Return >= CellularReturnType_Distance2)
+            {
+                distance1 = _mm256_sqrt_ps(distance1);
+            }
+        }
+
+        __m256 one = _mm256_set1_ps(1);
+        switch (Return)
+        {
+        case CellularReturnType_CellValue:
+            return _mm256_mul_ps(_mm256_cvtepi32_ps(closestHash), _mm256_set1_ps(1 / 2147483648.0f));
+        case CellularReturnType_Distance:
+            return _mm256_sub_ps(distance0, one);
+        case CellularReturnType_Distance2:
+            return _mm256_sub_ps(distance1, one);
+        case CellularReturnType_Distance2Add:
+            return _mm256_sub_ps(_mm256_mul_ps(_mm256_add_ps(distance1, distance0), _mm256_set1_ps(0.5f)), one);
+        case CellularReturnType_Distance2Sub:
+            return _mm256_sub_ps(_mm256_sub_ps(distance1, distance0), one);
+        case CellularReturnType_Distance2Mul:
+            return _mm256_sub_ps(_mm256_mul_ps(_mm256_mul_ps(distance1, distance0), _mm256_set1_ps(0.5f)), one);
+        case CellularReturnType_Distance2Div:
+            return _mm256_sub_ps(_mm256_div_ps(distance0, distance1), one);
+        default:
+            return _mm256_setzero_ps();
+        }
+    }
+#endif
 };
 
 template <>
@@ -2556,6 +4444,27 @@ const T FastNoiseLite::Lookup<T>::Gradients3D[] =
     1, 1, 0, 0,  0,-1, 1, 0, -1, 1, 0, 0,  0,-1,-1, 0
 };
 
+template <typename T>
+const T FastNoiseLite::Lookup<T>::Gradients4D[] =
+{
+     0, 1, 1, 1,   0, 1, 1,-1,   0, 1,-1, 1,   0, 1,-1,-1,
+     0,-1, 1, 1,   0,-1, 1,-1,   0,-1,-1, 1,   0,-1,-1,-1,
+     1, 0, 1, 1,   1, 0, 1,-1,   1, 0,-1, 1,   1, 0,-1,-1,
+    -1, 0, 1, 1,  -1, 0, 1,-1,  -1, 0,-1, 1,  -1, 0,-1,-1,
+     1, 1, 0, 1,   1, 1, 0,-1,   1,-1, 0, 1,   1,-1, 0,-1,
+    -1, 1, 0, 1,  -1, 1, 0,-1,  -1,-1, 0, 1,  -1,-1, 0,-1,
+     1, 1, 1, 0,   1, 1,-1, 0,   1,-1, 1, 0,   1,-1,-1, 0,
+    -1, 1, 1, 0,  -1, 1,-1, 0,  -1,-1, 1, 0,  -1,-1,-1, 0,
+     0, 1, 1, 1,   0, 1, 1,-1,   0, 1,-1, 1,   0, 1,-1,-1,
+     0,-1, 1, 1,   0,-1, 1,-1,   0,-1,-1, 1,   0,-1,-1,-1,
+     1, 0, 1, 1,   1, 0, 1,-1,   1, 0,-1, 1,   1, 0,-1,-1,
+    -1, 0, 1, 1,  -1, 0, 1,-1,  -1, 0,-1, 1,  -1, 0,-1,-1,
+     1, 1, 0, 1,   1, 1, 0,-1,   1,-1, 0, 1,   1,-1, 0,-1,
+    -1, 1, 0, 1,  -1, 1, 0,-1,  -1,-1, 0, 1,  -1,-1, 0,-1,
+     1, 1, 1, 0,   1, 1,-1, 0,   1,-1, 1, 0,   1,-1,-1, 0,
+    -1, 1, 1, 0,  -1, 1,-1, 0,  -1,-1, 1, 0,  -1,-1,-1, 0
+};
+
 template <typename T>
 const T FastNoiseLite::Lookup<T>::RandVecs3D[] =
 {
@@ -2593,4 +4502,41 @@ const T FastNoiseLite::Lookup<T>::RandVecs3D[] =
     -0.7870349638f, 0.03447489231f, 0.6159443543f, 0, -0.2015596421f, 0.6859872284f, 0.6991389226f, 0, -0.08581082512f, -0.10920836f, -0.9903080513f, 0, 0.5532693395f, 0.7325250401f, -0.396610771f, 0, -0.1842489331f, -0.9777375055f, -0.1004076743f, 0, 0.0775473789f, -0.9111505856f, 0.4047110257f, 0, 0.1399838409f, 0.7601631212f, -0.6344734459f, 0, 0.4484419361f, -0.845289248f, 0.2904925424f, 0
 };
 
+template <typename T>
+const T FastNoiseLite::Lookup<T>::RandVecs4D[] =
+{
+    0.1308934822f, -0.4106003525f, 0.0538675106f, 0.9007621985f, 0.4779633062f, 0.4217152329f, -0.720104427f, -0.2741476874f, 0.3577815563f, 0.4640813859f, -0.8103152892f, -0.0031555223f, 0.7949417486f, 0.1431249647f, 0.2752844899f, 0.5213456727f, -0.9063533693f, -0.0416861371f, 0.1721239028f, 0.3836133444f, 0.7953435042f, 0.4852063285f, -0.3550792394f, -0.0769562396f, 0.1093726153f, 0.2850392473f, 0.2935120557f, 0.90589234f, -0.5843386266f, 0.241434803f, 0.6874254812f, 0.3573567029f,
+    0.6403091048f, -0.0723840882f, -0.03298108f, -0.7639875931f, 0.4448044428f, 0.3019789001f, 0.7405875985f, 0.403097706f, -0.2567502559f, -0.0624492672f, -0.9069428331f, 0.3280763518f, -0.7869268635f, -0.266963993f, 0.5130897811f, -0.2149772417f, 0.4117107821f, -0.6216024006f, 0.0044308001f, -0.6663970705f, -0.387323096f, -0.0763312553f, -0.90488716f, 0.1591652801f, 0.1119933272f, -0.9585675864f, 0.2476674244f, -0.0852439082f, -0.0937432772f, 0.0024671373f, -0.6251770384f, 0.7748288727f,
+    0.6535994555f, 0.597721987f, 0.3841734256f, -0.2606663712f, 0.8728656351f, 0.3201871455f, -0.1313344221f, -0.3440015182f, -0.0578399629f, 0.1849677001f, 0.5437851376f, -0.816541005f, 0.8673435467f, -0.4511498086f, -0.1869279082f, -0.0961092049f, -0.9839178951f, 0.1153682819f, 0.0051165896f, -0.1362701571f, 0.6578275785f, 0.0339555728f, 0.6689752367f, -0.3443574143f, -0.6969317641f, 0.5746471962f, 0.3195963972f, -0.2862251894f, -0.0683387468f, 0.9418498727f, 0.2821797271f, 0.1691840257f,
+    0.8944245786f, 0.1422072674f, 0.0442831181f, 0.421688003f, -0.6539859677f, 0.6206257774f, -0.1021686929f, -0.4203421899f, -0.8591416544f, 0.0566523669f, 0.2703810359f, -0.4307670163f, -0.436557702f, -0.4192709775f, -0.1307283491f, 0.7852001776f, 0.3693927796f, 0.9180390075f, 0.1300590612f, 0.0619515595f, 0.2154429474f, 0.2648906233f, 0.678022464f, -0.6509245981f, -0.2498747838f, -0.5202390574f, 0.4141682493f, 0.7038313554f, -0.4367389783f, 0.3884517492f, -0.809212405f, 0.0594944275f,
+    0.0608105022f, -0.5241824353f, 0.401262348f, -0.7486810973f, -0.0046233105f, 0.7111400293f, 0.4876733842f, -0.5063922927f, -0.2856065691f, 0.5740793152f, 0.1241832471f, -0.7572584425f, 0.0282820913f, -0.9268381594f, -0.3708466794f, 0.0514187712f, 0.1498503791f, -0.7549015704f, -0.6382535157f, -0.0173474073f, 0.4098340725f, -0.4446199987f, -0.0173269904f, -0.7962718538f, -0.1330419645f, -0.4794143594f, 0.7630453319f, 0.4125815425f, 0.5808558217f, 0.7491923267f, 0.0626964014f, -0.3120681547f,
+    0.5624536575f, -0.3518901077f, -0.6938719951f, -0.2799301513f, 0.1471919941f, 0.0550507434f, -0.1815780809f, -0.9707385503f, -0.609899188f, -0.732157836f, -0.0397820556f, 0.3006414337f, 0.2402101667f, -0.0475173672f, -0.9648716212f, -0.0952046753f, 0.6957624642f, -0.2016082647f, -0.2032627787f, -0.6587510484f, -0.9351231784f, 0.2793138491f, 0.1268685597f, -0.1772929312f, -0.0018743765f, -0.1973963523f, -0.8097259824f, 0.5526074558f, 0.498725009f, -0.6820416995f, 0.5346546062f, 0.0153927764f,
+    0.0293492406f, -0.1494367191f, 0.2151904034f, -0.9646244758f, 0.3225992162f, -0.7133127405f, -0.4167915785f, -0.4619517941f, -0.7340361525f, -0.2025796102f, 0.5869976043f, 0.27492952f, 0.8436281851f, -0.0513677923f, -0.1173615758f, -0.5214202679f, -0.8112766199f, 0.0939993605f, 0.0703140268f, -0.572756758f, -0.2589714646f, 0.0514817098f, -0.8526524708f, -0.4508516142f, -0.6903647275f, 0.5960177771f, -0.3843044567f, -0.1430714403f, -0.0696092763f, -0.1986991933f, -0.7378491729f, -0.6412891526f,
+    -0.2507372105f, 0.6735923909f, -0.3709854928f, 0.58802543f, 0.3107227126f, 0.804248313f, 0.110301931f, -0.4944386018f, -0.2645555639f, 0.342684604f, 0.4920565944f, 0.75528665f, 0.401698222f, -0.7167165697f, -0.5386828522f, 0.1864850716f, 0.0566605584f, 0.8428839645f, -0.530821712f, 0.0675611841f, -0.1076359518f, 0.582902504f, 0.8040304341f, 0.0466286796f, -0.5420985401f, 0.302339149f, -0.5824507976f, -0.5248535797f, 0.5037547279f, -0.4939985764f, -0.2730625777f, -0.6539368542f,
+    -0.4551744311f, -0.1224639598f, 0.7596861507f, -0.4479908126f, -0.5800732152f, 0.5053049405f, -0.5773899326f, 0.273501093f, 0.7720285914f, 0.1182449026f, 0.5899339226f, -0.2048608406f, 0.66491514f, -0.7019374998f, 0.2531865191f, 0.0326831685f, -0.4327901983f, 0.7802303616f, -0.2491476208f, -0.3766413282f, 0.4140154525f, -0.500700673f, 0.4615523084f, 0.6040360153f, 0.4898241069f, -0.3193701695f, -0.8103910961f, 0.0366239073f, -0.3102013078f, 0.3883300273f, 0.7244666883f, -0.4776221898f,
+    0.2288404293f, -0.912419923f, -0.3036771812f, 0.1513344362f, -0.7411647998f, -0.4602909345f, -0.4443127201f, 0.2034531935f, -0.1474468966f, -0.1742848108f, 0.889567406f, -0.3956691137f, -0.7462337444f, -0.6251624033f, 0.2265614663f, 0.031258122f, -0.1037841893f, -0.6728669543f, -0.127614757f, 0.7212443259f, 0.4615458169f, -0.4849285721f, -0.7379340041f, -0.0852827332f, 0.1329275659f, -0.1353103591f, -0.5088722517f, -0.8396847029f, -0.067319167f, -0.3129536447f, 0.4498418854f, -0.8337688074f,
+    -0.1520902521f, 0.875464818f, 0.4339385663f, 0.148752238f, 0.3270387527f, 0.1975726044f, -0.5961807051f, -0.7061014709f, -0.5617159997f, 0.0736100012f, -0.7913152903f, -0.2299495917f, -0.5436805746f, 0.4878790282f, -0.6636951295f, 0.1609169407f, 0.3959954032f, 0.3832885812f, -0.1763630742f, 0.8155817373f, 0.7918180907f, -0.2274868379f, -0.2724590811f, 0.4970310845f, -0.0635067138f, -0.9209920411f, 0.1173862559f, -0.3660068638f, 0.6716114833f, -0.1381337028f, 0.1069103398f, -0.7200189406f,
+    0.4895269199f, -0.6819006987f, 0.4569868972f, 0.2941730912f, -0.0230424487f, -0.9273237585f, 0.0513303005f, 0.3700066118f, 0.0862675103f, -0.4400520699f, 0.0811694763f, 0.8901256139f, 0.4527612603f, 0.4079064158f, -0.656907507f, -0.4439505877f, 0.8277317262f, -0.2756807069f, -0.4112512712f, 0.2640695536f, 0.1288142882f, -0.2907343838f, 0.9433066416f, 0.0951471344f, 0.2932251486f, -0.8178820762f, -0.4850707222f, 0.0989662375f, -0.1828864314f, 0.965348397f, 0.1183313811f, -0.1437105072f,
+    0.7317813122f, -0.2108424961f, 0.4268076597f, 0.4877261266f, 0.2543078427f, -0.0624234052f, 0.0735492799f, -0.9623000276f, 0.8266125735f, -0.4869611992f, 0.2500391656f, -0.1306172251f, -0.3379399692f, -0.9386765639f, -0.0677990138f, -0.0092832824f, -0.1390063776f, 0.54073134f, -0.7079271764f, 0.4325805796f, 0.0179095572f, 0.0344926571f, -0.5452349765f, -0.8373818273f, -0.7079630707f, 0.0737745594f, -0.1743905507f, -0.6803921963f, 0.0618475381f, -0.2168629086f, -0.2819807188f, -0.9325407418f,
+    -0.4725039979f, 0.4096031807f, 0.5359992805f, 0.5671595698f, 0.3561251173f, -0.8675596777f, 0.3032819876f, -0.1689234808f, -0.6819545415f, -0.4554607694f, -0.5510522807f, -0.1543854747f, 0.6159041755f, 0.4751515039f, 0.6201542946f, 0.1014975165f, 0.7197276076f, 0.1253725626f, 0.5269046525f, 0.4343332575f, 0.4547631497f, 0.4778569487f, -0.7406746949f, -0.1274527778f, 0.2952675964f, -0.7342218888f, -0.4866648947f, -0.3699899253f, 0.0929881331f, -0.7202228898f, -0.5022476007f, 0.4694459966f,
+    0.558660467f, 0.0881968832f, -0.5939637764f, -0.5721248332f, -0.1923784139f, 0.0954128461f, 0.5567180475f, 0.8024661677f, 0.1823825275f, -0.5569157915f, 0.6986992327f, -0.4103666618f, -0.0038382901f, -0.4648585965f, 0.8529426448f, -0.2374459885f, 0.6427281385f, 0.7565379998f, 0.1112303176f, 0.0466755968f, 0.1517444439f, -0.8921778674f, -0.0484040485f, 0.4226692852f, 0.3100151365f, -0.1900793906f, 0.7557883178f, -0.5445589582f, -0.6400237276f, 0.4098383805f, -0.5355928406f, 0.3681608876f,
+    -0.2713124699f, -0.9083309719f, 0.3180477795f, -0.0130383693f, -0.1318096402f, 0.3401231155f, 0.2377867059f, -0.9002221768f, 0.2290751482f, -0.4846311519f, 0.0677627968f, -0.8414662361f, -0.3164492786f, 0.1461125623f, 0.9234591081f, 0.160418979f, 0.3427708473f, -0.3295621214f, 0.865424785f, 0.1579142041f, -0.0365541835f, 0.1968445055f, 0.286471573f, 0.9369365348f, 0.4931845302f, -0.3553659398f, -0.7849716242f, 0.1195977308f, -0.3059946958f, 0.4617791794f, 0.1580547219f, -0.8174019455f,
+    0.4300812723f, -0.3661739149f, 0.3807709744f, -0.7320930462f, 0.0754022342f, 0.9210064477f, -0.3589836552f, -0.1311196464f, 0.182573905f, 0.9495174883f, 0.2409443742f, -0.0838398305f, 0.8454016469f, -0.1962694889f, -0.4072743615f, 0.2844326593f, -0.0584484219f, 0.1690667242f, 0.9759887291f, 0.124282844f, 0.1302838458f, 0.9846149789f, -0.0263036074f, 0.1134353697f, -0.5290989249f, 0.4246937189f, 0.7138103969f, -0.1736786978f, 0.632049307f, -0.1161248006f, 0.42424303f, -0.6380020029f,
+    0.8547954067f, 0.1232986388f, -0.1935676766f, -0.4654608607f, -0.3339606016f, 0.1405379239f, 0.6510691033f, -0.6669545945f, 0.6902884211f, 0.5544295648f, -0.128536066f, 0.446752989f, -0.112822197f, 0.7720353925f, 0.1509889744f, -0.6069883311f, 0.3492080451f, 0.3745163965f, -0.5189389518f, 0.6844659045f, 0.4588984449f, 0.1898350833f, -0.7685461762f, 0.4033753009f, 0.2624083697f, 0.6324952594f, -0.6911126138f, -0.2312032644f, 0.3167817169f, -0.8530168372f, -0.0744988343f, -0.4079969889f,
+    0.0199443361f, -0.7530988406f, -0.6127699846f, -0.2386572979f, 0.6132413392f, -0.2097102074f, -0.4235217327f, -0.6329186605f, -0.2049350182f, -0.5129847519f, 0.1200842469f, -0.8248806315f, -0.5089757823f, -0.6306922241f, -0.321896654f, -0.4894420452f, -0.7060046256f, 0.0476399912f, 0.6035370909f, -0.3674654812f, 0.9498449355f, 0.2346044214f, -0.2045360488f, 0.0303375783f, 0.389896847f, 0.2763472185f, 0.4069050688f, 0.7784863059f, 0.4768481964f, 0.4516885928f, 0.62744762f, 0.4182136977f,
+    0.9416900815f, 0.055922397f, 0.214329253f, 0.2532892561f, -0.1218501119f, 0.1615955888f, -0.0109895192f, 0.9792439157f, -0.2996671319f, 0.6545550777f, -0.3830458793f, -0.5788204511f, -0.8516781296f, 0.2515552598f, -0.2715174456f, -0.3710021449f, 0.3739944156f, 0.1083938201f, 0.9087040984f, 0.1504520467f, 0.696042638f, 0.4490078099f, -0.5038722194f, -0.2450090188f, -0.3170573673f, -0.6229516305f, -0.2923653636f, 0.6526318917f, 0.4497761132f, 0.0961354145f, 0.4198312574f, 0.7824328376f,
+    -0.8936930249f, -0.3171593034f, 0.0695782348f, 0.3096475784f, 0.2222225618f, 0.3399256139f, 0.4154751823f, 0.8139091368f, -0.2203189866f, 0.7052274278f, -0.4998811289f, 0.4519210952f, 0.3303334833f, 0.6850084587f, 0.3273303124f, -0.5608012731f, 0.0845901027f, 0.7411669647f, 0.6504584725f, 0.1428979378f, -0.7907953565f, 0.3331503538f, 0.5087671727f, -0.0693506304f, -0.2806058738f, 0.5916955663f, 0.7265054832f, 0.2081981826f, 0.9039254721f, 0.0065267359f, 0.3036325872f, -0.3011368369f,
+    0.3915602021f, -0.4221199992f, -0.6049447074f, 0.5500338312f, -0.5074329004f, -0.7139618788f, 0.2321613838f, 0.4229318848f, -0.8338775478f, 0.0560531516f, -0.5442576675f, 0.072731498f, 0.2898950239f, -0.7864695089f, 0.3226336918f, -0.439697723f, -0.0972092603f, -0.7791669043f, 0.1705150275f, 0.5952931382f, 0.3460151301f, -0.450147568f, -0.810010352f, 0.1467103487f, -0.0779674072f, 0.4089160706f, -0.8411775033f, 0.3451508923f, -0.7594311814f, -0.1392207275f, 0.4530570137f, -0.4456693978f,
+    -0.5631091439f, -0.1748166769f, -0.5765362276f, 0.5656440576f, -0.1650471711f, -0.5581199191f, -0.8017946176f, 0.1355985932f, 0.4511640031f, -0.3620700124f, -0.7279781735f, -0.3679729981f, -0.2067859201f, -0.1467012519f, 0.1644588388f, -0.9532426849f, -0.5747968985f, 0.4372738868f, 0.626864836f, -0.2923021567f, -0.5569921454f, -0.0845642172f, 0.4248061138f, 0.7086243072f, 0.1316822589f, -0.1680966593f, 0.3712645959f, -0.9036403575f, 0.0898668924f, -0.7440215992f, 0.5698203276f, -0.3371358714f,
+    0.4414062692f, 0.7385768529f, -0.4234257554f, -0.2835054981f, -0.3583295822f, -0.4383127925f, 0.8238357018f, 0.0278665193f, -0.3538340447f, 0.5853252983f, 0.6528968838f, -0.3254557161f, 0.6443052557f, -0.2480800561f, 0.5616474109f, -0.455937725f, -0.3590607806f, -0.0206637868f, -0.6067023927f, -0.7089150658f, 0.8793168241f, 0.3193388417f, -0.3030522365f, 0.1816148918f, 0.7998607306f, 0.5773377674f, -0.1475452397f, 0.0716541424f, 0.0389104635f, 0.4623405225f, -0.1696342954f, 0.8694546699f,
+    -0.2281954373f, 0.1311216879f, 0.9629683538f, 0.0585311459f, 0.4952501864f, -0.1897545865f, 0.6090880908f, 0.5896881782f, 0.4627089467f, -0.7650992553f, -0.3362170944f, 0.2957729291f, -0.758453692f, -0.5957671716f, 0.2482314192f, -0.090502137f, 0.951139253f, 0.1384460566f, 0.0041038149f, -0.2759528393f, 0.1786996989f, -0.147646972f, -0.3643438933f, -0.9019536111f, 0.8512405518f, -0.1475128622f, -0.5035915213f, -0.0050057988f, -0.2893475442f, -0.9549114725f, 0.0606844615f, -0.0271932787f,
+    0.6331605094f, 0.6251186793f, 0.4156123403f, -0.1886817127f, 0.0456990239f, -0.4335496964f, -0.6247859594f, -0.6477567173f, -0.6331950289f, 0.2176837569f, -0.1516056447f, 0.7271131726f, -0.6085011252f, -0.3658396526f, 0.4355061313f, 0.5533734172f, 0.2270014418f, 0.2200433097f, -0.8441929214f, 0.4328852026f, -0.6110763906f, 0.4704853596f, -0.6365675807f, 0.0032994655f, 0.5040878855f, -0.2505894841f, -0.4720786994f, -0.6784113912f, -0.3870926597f, 0.906014137f, 0.1708886052f, -0.0097334981f,
+    -0.2771825996f, 0.8486044621f, 0.1798301349f, 0.4131602545f, 0.0236347872f, 0.253130819f, -0.2849860199f, -0.924201901f, -0.3818228998f, -0.4957471297f, -0.1965794124f, 0.7548526951f, -0.3974581568f, 0.6312000788f, -0.5302804347f, -0.4030088519f, 0.2819217185f, -0.5037621569f, 0.5684806089f, -0.5861515428f, 0.4010959241f, -0.0745317181f, 0.0038639485f, 0.9129907735f, 0.0362758319f, 0.6515027644f, -0.016358961f, 0.757601872f, 0.2574434494f, -0.923295722f, -0.0590515572f, -0.2788562241f,
+    -0.0100848079f, 0.9763025769f, -0.1293623271f, -0.1731963145f, -0.4505355248f, -0.7880071318f, 0.0122125139f, -0.4194202612f, 0.166387345f, -0.2755456242f, 0.9402098755f, -0.1113339585f, -0.0372704157f, 0.5947644262f, -0.6598597215f, 0.4576585424f, -0.8805726206f, 0.4307641287f, 0.1787151592f, -0.0842319249f, -0.736333551f, -0.0390648543f, 0.6517312743f, -0.1775758565f, -0.6468057646f, -0.5169277173f, 0.3668130121f, -0.4241182053f, 0.8215448775f, 0.1606414221f, 0.3148133025f, -0.4473823112f,
+    -0.1727341012f, -0.19227542f, 0.8721464184f, -0.4153958571f, 0.3197939012f, 0.5736153004f, -0.0392390438f, 0.7530986956f, -0.8907912236f, 0.3618744904f, 0.1192541551f, -0.2476212745f, -0.7866181919f, -0.3977725857f, -0.2467683174f, 0.4026340618f, 0.5567212605f, 0.3041830319f, 0.5303240848f, 0.5623970895f, 0.9582989366f, 0.1339164609f, -0.1467146277f, -0.2054369674f, -0.3794608811f, -0.0697606173f, -0.8631773917f, 0.325680344f, 0.3432714657f, -0.6286698882f, -0.1779624304f, -0.6747356859f,
+    0.8103198686f, 0.209097417f, 0.3821861699f, 0.3919103371f, -0.7668452642f, -0.0161053011f, 0.0538666493f, 0.6393647974f, 0.2952957595f, -0.2398249457f, -0.1899791329f, 0.9050924477f, -0.5040461575f, 0.1465242805f, -0.7581702855f, -0.386840955f, 0.9981965266f, 0.0577595394f, -0.0157319098f, 0.0044762557f, -0.5469201341f, -0.3237416266f, -0.5075152076f, 0.5818058441f, 0.5810692905f, 0.3545565466f, -0.3045749109f, 0.6662448939f, -0.0712604536f, 0.4195952499f, 0.9042914645f, -0.0334472904f,
+    -0.4086592285f, -0.3967035806f, 0.5246841138f, 0.6327167492f, -0.7444671061f, 0.3189113585f, 0.5864658427f, 0.0110493719f, 0.7568312545f, 0.1544512527f, -0.5151307487f, 0.371472172f, 0.6818068747f, 0.2694566652f, 0.4946247432f, 0.4667749506f, 0.0321788267f, -0.6280817816f, 0.4373541005f, -0.6428057167f, 0.7006723934f, -0.0291494902f, -0.6785085024f, -0.2187114916f, -0.0844192321f, -0.2676330773f, -0.6597321583f, 0.6971365781f, -0.0111830113f, 0.5404303853f, 0.6118214639f, 0.5774811124f,
+    -0.5371300067f, -0.1572886972f, -0.4655532326f, -0.6855740728f, 0.6010090761f, -0.6008491227f, -0.3650418612f, -0.3801484733f, 0.024397165f, 0.0240218911f, 0.5916603651f, 0.8054599552f, 0.4153422903f, -0.7807444493f, -0.2977728553f, 0.3595277646f, 0.1254094876f, -0.0778127525f, 0.9539616848f, -0.2611029296f, 0.4214234294f, 0.7544451407f, -0.3601007906f, -0.3514857657f, 0.5926516269f, 0.6039495673f, -0.5138917756f, 0.1411531515f, 0.7821769192f, 0.4793863441f, 0.3134740886f, 0.245197871f,
+};
+
 #endif
\ No newline at end of file
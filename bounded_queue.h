@@ -0,0 +1,62 @@
+#ifndef BOUNDED_QUEUE_H
+#define BOUNDED_QUEUE_H
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+// First in first out queue between threads that holds at most a fixed number of items
+// push waits while the queue is full, so a fast producer is held back by a slow consumer instead of using more memory
+template<typename T>
+class BoundedQueue {
+public:
+    BoundedQueue(size_t capacity) : capacity(capacity > 0 ? capacity : 1) {}
+
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    // Waits for space, returns false without adding the item if the queue was closed
+    bool push(T item)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        notFull.wait(lock, [&]{ return closed || items.size() < capacity; });
+        if (closed) return false;
+
+        items.push_back(std::move(item));
+        notEmpty.notify_one();
+        return true;
+    }
+
+    // Waits for an item, returns false once the queue is closed and empty
+    bool pop(T& item)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        notEmpty.wait(lock, [&]{ return closed || !items.empty(); });
+        if (items.empty()) return false;
+
+        item = std::move(items.front());
+        items.pop_front();
+        notFull.notify_one();
+        return true;
+    }
+
+    // No more pushes are accepted, items already queued can still be popped
+    void close()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        closed = true;
+        notEmpty.notify_all();
+        notFull.notify_all();
+    }
+
+private:
+    size_t capacity;
+    std::deque<T> items;
+    std::mutex mutex;
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+    bool closed = false;
+};
+
+#endif
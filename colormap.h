@@ -0,0 +1,120 @@
+#ifndef COLORMAP_H
+#define COLORMAP_H
+
+#include "colors.h"
+#include "quantize.h"
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+enum ColormapPalette {
+    ColormapPalette_Hue,       // Hue around the color wheel at half saturation and value, the explorer's original look
+    ColormapPalette_Grayscale,
+    ColormapPalette_Viridis,
+    ColormapPalette_Banded     // Hue in flat steps so contours stand out
+};
+
+// Table of colors for noise values, built once when the palette changes so converting a voxel is a single lookup
+// Colors are 4 bytes each, r g b a, the same layout as raylib's Color
+class Colormap {
+public:
+    static const int DefaultSize = 1024; // Finer than the 8 bit output for every palette
+    static const int BandCount = 10;
+
+    // Builds the table if the palette or size differ from the last call, returns true if it was rebuilt
+    bool configure(int newPalette, int newSize = DefaultSize)
+    {
+        if (newPalette == palette && newSize == (int)table.size()) return false;
+        palette = newPalette;
+        table.resize(newSize);
+
+        if (palette == ColormapPalette_Hue || palette == ColormapPalette_Banded){
+            // Same conversion the explorer used per voxel, values of -1 to 1 went to hues of 0 to 360
+            std::vector<float> hues(newSize), half(newSize, 0.5f);
+            for (int i = 0; i < newSize; i++) hues[i] = hue(palette, (float)i/(newSize-1));
+
+            hsv2rgb_batch(hues.data(), half.data(), half.data(), (uint8_t*)table.data(), newSize);
+            return true;
+        }
+
+        for (int i = 0; i < newSize; i++){
+            unsigned char rgba[4];
+            entry(palette, (float)i/(newSize-1), rgba);
+            memcpy(&table[i], rgba, 4);
+        }
+        return true;
+    }
+
+    int size() const { return (int)table.size(); }
+
+    // Colors for values, min maps to the first entry and max to the last, values outside are clamped
+    void mapValues(const float* values, unsigned char* rgba, int count, float min = -1, float max = 1) const
+    {
+        float scale = (table.size()-1)/(max - min);
+        float offset = -min*scale + 0.5f;
+        map(values, rgba, count, scale, offset);
+    }
+
+    // Same as mapValues for quantized codes, the dequantize step is folded into the table index so it is one multiply add
+    template<typename T>
+    void mapCodes(const T* codes, unsigned char* rgba, int count, QuantizeRange range, float min = -1, float max = 1) const
+    {
+        float scale = (table.size()-1)/(max - min);
+        map(codes, rgba, count, range.scale*scale, (range.offset - min)*scale + 0.5f);
+    }
+
+private:
+    // index = value * scale + offset, written as a plain loop so it turns into a gather
+    template<typename T>
+    void map(const T* values, unsigned char* rgba, int count, float scale, float offset) const
+    {
+        const uint32_t* colors = table.data();
+        const float last = (float)(table.size()-1);
+
+        for (int i = 0; i < count; i++){
+            float index = values[i]*scale + offset;
+            if (std::is_floating_point<T>::value) index = isNaNBits((float)values[i]) ? 0 : index; // NaN gets the first color, codes can't be NaN
+            index = index > 0 ? index : 0;
+            index = index < last ? index : last;
+
+            uint32_t color = colors[(int)index];
+            memcpy(rgba + i*4, &color, 4);
+        }
+    }
+
+    static float hue(int palette, float t)
+    {
+        if (palette == ColormapPalette_Banded){
+            t = ((t < 1 ? (int)(t*BandCount) : BandCount-1) + 0.5f)/BandCount; // Middle of each band so the first and last don't both land on red
+        }
+        return t*360;
+    }
+
+    // Palettes that aren't built from hues
+    static void entry(int palette, float t, unsigned char* rgba)
+    {
+        rgba[3] = 255;
+
+        if (palette == ColormapPalette_Grayscale){
+            rgba[0] = rgba[1] = rgba[2] = (unsigned char)(t*255 + 0.5f);
+            return;
+        }
+
+        // matplotlib's viridis at every eighth, linear in between
+        static const unsigned char stops[9][3] = {
+            {68, 1, 84}, {71, 44, 122}, {59, 81, 139}, {44, 113, 142}, {33, 144, 141},
+            {39, 173, 129}, {92, 200, 99}, {170, 220, 50}, {253, 231, 37}
+        };
+        float position = t*8;
+        int stop = position < 7 ? (int)position : 7;
+        float f = position - stop;
+
+        for (int c = 0; c < 3; c++) rgba[c] = (unsigned char)(stops[stop][c] + (stops[stop+1][c] - stops[stop][c])*f + 0.5f);
+    }
+
+    int palette = -1;
+    std::vector<uint32_t> table;
+};
+
+#endif
@@ -1,3 +1,9 @@
+#ifndef COLORS_H
+#define COLORS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
 typedef struct rgbColor {
     double r;       // a fraction between 0 and 1
     double g;       // a fraction between 0 and 1
@@ -115,3 +121,58 @@ rgbColor hsv2rgb(hsvColor in)
     }
     return out;     
 }
+
+
+// Batch versions of the above for converting many colors at once
+// Floats in separate arrays and no branches or switches so the loops vectorize (with -Ofast as in make.bat), h is in degrees, s and v are 0 to 1
+// rgba is 4 bytes per color with alpha set to 255, the same layout as raylib's Color
+
+void hsv2rgb_batch(const float* h, const float* s, const float* v, uint8_t* rgba, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        float hh = h[i] >= 0.0f && h[i] < 360.0f ? h[i] / 60.0f : 0.0f; // Same as hsv2rgb, 360 and over goes to 0
+        float chroma = v[i] * (s[i] > 0.0f ? s[i] : 0.0f);
+
+        // Each channel is v minus a trapezoid of the chroma, offset around the wheel, k is kept in 0 to 6 without a modulo
+        float kr = hh + 5.0f; kr = kr >= 6.0f ? kr - 6.0f : kr;
+        float kg = hh + 3.0f; kg = kg >= 6.0f ? kg - 6.0f : kg;
+        float kb = hh + 1.0f; kb = kb >= 6.0f ? kb - 6.0f : kb;
+
+        float tr = 4.0f - kr < kr ? 4.0f - kr : kr; tr = tr < 1.0f ? tr : 1.0f; tr = tr > 0.0f ? tr : 0.0f;
+        float tg = 4.0f - kg < kg ? 4.0f - kg : kg; tg = tg < 1.0f ? tg : 1.0f; tg = tg > 0.0f ? tg : 0.0f;
+        float tb = 4.0f - kb < kb ? 4.0f - kb : kb; tb = tb < 1.0f ? tb : 1.0f; tb = tb > 0.0f ? tb : 0.0f;
+
+        rgba[i*4 + 0] = (uint8_t)((v[i] - chroma * tr) * 255.0f);
+        rgba[i*4 + 1] = (uint8_t)((v[i] - chroma * tg) * 255.0f);
+        rgba[i*4 + 2] = (uint8_t)((v[i] - chroma * tb) * 255.0f);
+        rgba[i*4 + 3] = 255;
+    }
+}
+
+void rgb2hsv_batch(const uint8_t* rgba, float* h, float* s, float* v, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        float r = rgba[i*4 + 0] * (1.0f / 255.0f);
+        float g = rgba[i*4 + 1] * (1.0f / 255.0f);
+        float b = rgba[i*4 + 2] * (1.0f / 255.0f);
+
+        float max = r > g ? r : g; max = max > b ? max : b;
+        float min = r < g ? r : g; min = min < b ? min : b;
+        float delta = max - min;
+        bool gray = delta < 0.00001f;                   // Hue is undefined, 0 like rgb2hsv
+        float invDelta = 1.0f / (gray ? 1.0f : delta);
+
+        // All three sectors are worked out and the right one picked, cheaper than branching per pixel once vectorized
+        float hue = r >= max ? (g - b) * invDelta
+                  : g >= max ? 2.0f + (b - r) * invDelta
+                  :            4.0f + (r - g) * invDelta;
+        hue *= 60.0f;
+        hue = hue < 0.0f ? hue + 360.0f : hue;
+
+        h[i] = gray ? 0.0f : hue;
+        s[i] = gray ? 0.0f : delta / max;               // max is above 0 whenever delta is
+        v[i] = max;
+    }
+}
+
+#endif
@@ -22,10 +22,18 @@
 #include "raylib.h" // Include rendering library
 #include "FastNoiseLite.hpp" // FastNoiseLite library for generating noise
 #include "colors.h" // Color handler library
+#include "colormap.h" // Noise value to color lookup tables
+#include "thread_pool.h" // Worker threads for sampling noise
+#include "voxel_mesh.h" // Single mesh for all drawn voxel sides
+#include "noise_volume.h" // Samples the cube in the background
+#include "volume_raymarch.h" // Draws the whole volume with a shader
+#include "profiler.h" // Frame timings per stage
 #include <random> // Random lib
 #include <deque>
+#include <vector>
 #include <limits>
 #include <cmath>
+#include <algorithm>
 
 #define NK_INCLUDE_FIXED_TYPES
 #define NK_INCLUDE_STANDARD_IO
@@ -39,32 +47,40 @@
 #include "nuklear.h"
 #include "nuklear_raylib.h"
 
-void add_option_int(nk_context *ctx, char* name, int* outVar, int min, int max, int step){
+bool add_option_int(nk_context *ctx, char* name, int* outVar, int min, int max, int step){ // Returns true if the value was changed
+    int old = *outVar;
     nk_layout_row_dynamic(ctx, 10, 1);
     nk_label(ctx, FormatText("%s: %i", name, *outVar), NK_TEXT_CENTERED);
     nk_slider_int(ctx, min, outVar, max, step);
     nk_layout_row_dynamic(ctx, 10, 1);
+    return *outVar != old;
 }
 
-void add_option_float(nk_context *ctx, char* name, float* outVar, float min, float max, float step){
+bool add_option_float(nk_context *ctx, char* name, float* outVar, float min, float max, float step){ // Returns true if the value was changed
+    float old = *outVar;
     nk_layout_row_dynamic(ctx, 10, 1);
     nk_label(ctx, FormatText("%s: %0f", name, *outVar), NK_TEXT_CENTERED);
     nk_slider_float(ctx, min, outVar, max, step);
     nk_layout_row_dynamic(ctx, 10, 1);
+    return *outVar != old;
 }
 
-void add_option_onoff(nk_context *ctx, char* name, int* outVar){
+bool add_option_onoff(nk_context *ctx, char* name, int* outVar){ // Returns true if the value was changed
+    int old = *outVar;
     nk_layout_row_dynamic(ctx, 10, 1);
     nk_label(ctx, FormatText("%s: %s", name, *outVar ? "True" : "False"), NK_TEXT_CENTERED);
     nk_slider_int(ctx, 0, outVar, 1, 1);
     nk_layout_row_dynamic(ctx, 10, 1);
+    return *outVar != old;
 }
 
-void add_option_list(nk_context *ctx, char* name, int* outVar, std::deque<char*> names){
+bool add_option_list(nk_context *ctx, char* name, int* outVar, std::deque<char*> names){ // Returns true if the value was changed
+    int old = *outVar;
     nk_layout_row_dynamic(ctx, 10, 1);
     nk_label(ctx, FormatText("%s: %s", name, names[*outVar]), NK_TEXT_CENTERED);
     nk_slider_int(ctx, 0, outVar, names.size()-1, 1);
     nk_layout_row_dynamic(ctx, 10, 1);
+    return *outVar != old;
 }
 
 void add_option_separator(nk_context *ctx, char* name){
@@ -74,6 +90,33 @@ void add_option_separator(nk_context *ctx, char* name){
     nk_layout_row_dynamic(ctx, 10, 1);
 }
 
+void add_profiler_window(nk_context *ctx, Profiler& profiler, int samplesStage){ // Frame time percentiles of every stage over the last few seconds
+    if (nk_begin(ctx, "Profiler", nk_rect(GetScreenWidth()-250, 0, 250, 220), NK_WINDOW_BORDER|NK_WINDOW_MINIMIZABLE|NK_WINDOW_TITLE|NK_WINDOW_MOVABLE)) {
+        nk_layout_row_dynamic(ctx, 12, 4);
+        nk_label(ctx, "ms", NK_TEXT_LEFT);
+        nk_label(ctx, "p50", NK_TEXT_RIGHT);
+        nk_label(ctx, "p95", NK_TEXT_RIGHT);
+        nk_label(ctx, "p99", NK_TEXT_RIGHT);
+
+        for (int stage = 0; stage < profiler.stageCount(); stage++){
+            nk_label(ctx, profiler.stageName(stage), NK_TEXT_LEFT);
+            nk_label(ctx, FormatText("%.2f", profiler.percentile(stage, 50)), NK_TEXT_RIGHT);
+            nk_label(ctx, FormatText("%.2f", profiler.percentile(stage, 95)), NK_TEXT_RIGHT);
+            nk_label(ctx, FormatText("%.2f", profiler.percentile(stage, 99)), NK_TEXT_RIGHT);
+        }
+
+        nk_layout_row_dynamic(ctx, 12, 1);
+        nk_label(ctx, FormatText("%s: %.2f M samples/sec", profiler.stageName(samplesStage), profiler.itemsPerSecond(samplesStage)/1e6), NK_TEXT_LEFT);
+
+        nk_layout_row_dynamic(ctx, 20, 1);
+        if (nk_button_label(ctx, "Save profile.csv")){
+            if (profiler.writeCsv("profile.csv")) TraceLog(LOG_INFO, "Saved frame timings to profile.csv");
+            else TraceLog(LOG_WARNING, "Could not write profile.csv");
+        }
+    }
+    nk_end(ctx);
+}
+
 FastNoiseLite noise;
 
 int wrap(int kX, int const kLowerBound, int const kUpperBound) // Just wraps an integer, nothing big
@@ -104,11 +147,40 @@ int main(int argc, char* argv[])
     float targetZoom = 1, currentZoom = 50;
     float defaultCamFov = 67.5f;
     int lockToCube = true;
-    float averagedNoise;
     bool hasBeenWarned = false;
     bool exitNow = false;
 
-    Vector3 tmpXYZ = {0, 0, 0}, tmpYZW = {0, 0, 0}, tmpZWX = {0, 0, 0}, tmpWXY = {0, 0, 0};
+    int animateW = true;
+    bool settingsChanged = true; // Set when any noise setting is changed from the gui
+    unsigned settingsVersion = 0; // Goes up with every change so volumes sampled with older settings can be told apart
+    NoiseVolume volume; // Last complete volume, drawn while the generator works on the next one
+    NoiseVolumeKey lastKey = {}; // Key of the previous frame without w, to notice settings being dragged
+    int previewFrames = 0; // Frames left where volumes are sampled at a lower resolution, set while settings keep changing
+    unsigned generation = 0; // Goes up when a change makes the volume being sampled useless, the generator drops jobs of older generations
+    double fullVolumeMs = 0; // Time the last full resolution volume took, decides how coarse previews are
+    VoxelMesh voxelMesh; // Outward sides of the voxels on the visible faces, rebuilt when the faces change and recolored when the noise changes
+    std::vector<VoxelSide> voxelSides;
+    int meshSize[3] = {0, 0, 0};
+    bool meshFaces[5] = {};
+    ThreadPool samplingPool; // One thread per core, the rows of each face are split between them
+    VolumeGenerator generator(samplingPool);
+    Colormap colormap; // Rebuilt only when the palette changes
+    int palette = ColormapPalette_Hue;
+    int renderMode = 0; // 0 draws the voxels on the faces of the cube, 1 raymarches the whole volume
+    float threshold = 0.2f; // Raymarch transfer function, noise below threshold is clear and the rest blocks opacity of the light per voxel
+    float opacity = 0.15f;
+    VolumeRaymarcher raymarcher;
+    bool raymarchCurrent = false; // The raymarcher has the drawn volume
+
+    Profiler profiler; // Frame stages shown in the Profiler window, Frame includes waiting for the 60 fps limit, Noise job is the time of each finished volume
+                      // over the finished volumes only, Colors includes sending new volumes to the gpu while raymarching
+    int frameStage = profiler.addStage("Frame");
+    int guiStage = profiler.addStage("Gui");
+    int guiDrawStage = profiler.addStage("Gui Draw");
+    int noiseStage = profiler.addStage("Noise job", true);
+    int colorStage = profiler.addStage("Colors");
+    int meshStage = profiler.addStage("Mesh");
+    int drawStage = profiler.addStage("Draw");
 
     SetConfigFlags(FLAG_WINDOW_RESIZABLE|FLAG_WINDOW_ALWAYS_RUN);
     InitWindow(screenWidth, screenHeight, "4D Noise Cube");
@@ -120,6 +192,8 @@ int main(int argc, char* argv[])
     camera.fovy = 45.0f;
     camera.type = CAMERA_PERSPECTIVE;
 
+    raymarcher.load();
+
     std::deque<char*> noiseNames = { "Open Simplex 2", "Open Simplex 2S", "Cellular", "Perlin", "Value Cubic", "Value" };
     noise.mNoiseType = (FastNoiseLite::NoiseType)1;
 
@@ -133,6 +207,9 @@ int main(int argc, char* argv[])
     std::deque<char*> warpTypes = { "Open Simplex 2", "Open Simplex 2 Reduced", "Basic Grid" };
     int warpType = 0;
 
+    std::deque<char*> paletteNames = { "Hue", "Grayscale", "Viridis", "Banded" };
+    std::deque<char*> renderModes = { "Voxel Faces", "Raymarch" };
+
     //--------------------------------------------------------------------------------------
 
     // Gui
@@ -166,8 +243,11 @@ int main(int argc, char* argv[])
     // Main game loop
     while (!exitNow)    // Detect window close button or ESC key
     {
+        Profiler::Scope frameTimer(profiler, frameStage);
+
         // Update Gui
         //----------------------------------------------------------------------------------
+        Profiler::Scope guiTimer(profiler, guiStage);
         nk_raylib_input(ctx); // Update the nuklear input        
         
         if (nk_begin(ctx, "Config", nk_rect(0, 0, nk_window_is_collapsed(ctx, "Config") ? 28 : 230, GetScreenHeight()), NK_WINDOW_BORDER|NK_WINDOW_MINIMIZABLE|NK_WINDOW_TITLE)) {
@@ -188,41 +268,53 @@ int main(int argc, char* argv[])
 
             add_option_separator(ctx, "Noise Settings");
             add_option_int(ctx, "Noise Sample Scale", &noiseSampleScale, 1, 50, 1);
+            add_option_onoff(ctx, "Animate W", &animateW);
+            add_option_list(ctx, "Palette", &palette, paletteNames);
+
+            add_option_separator(ctx, "Render Settings");
+            add_option_list(ctx, "Render Mode", &renderMode, renderModes);
+            if (renderMode == 1){
+                add_option_float(ctx, "Threshold", &threshold, -1, 1, 0.01);
+                add_option_float(ctx, "Opacity", &opacity, 0, 1, 0.01);
+            }
 
-            add_option_int(ctx, "Seed", &(noise.mSeed), 0, std::numeric_limits<int>::max(), 1);
+            settingsChanged |= add_option_int(ctx, "Seed", &(noise.mSeed), 0, std::numeric_limits<int>::max(), 1);
 
-            add_option_list(ctx, "Noise Type", (int*)&(noise.mNoiseType), noiseNames);
-            add_option_list(ctx, "Noise Modifier", &noiseMod, noiseMods);
+            settingsChanged |= add_option_list(ctx, "Noise Type", (int*)&(noise.mNoiseType), noiseNames);
+            settingsChanged |= add_option_list(ctx, "Noise Modifier", &noiseMod, noiseMods);
 
-            add_option_float(ctx, "Frequency", &(noise.mFrequency), 0.01, 0.5, 0.01);
-            add_option_float(ctx, "Gain", &(noise.mGain), 0.1, 10, 0.1);
-            add_option_float(ctx, "Lacunarity", &(noise.mLacunarity), 0.1, 10, 0.1);
+            settingsChanged |= add_option_float(ctx, "Frequency", &(noise.mFrequency), 0.01, 0.5, 0.01);
+            settingsChanged |= add_option_float(ctx, "Gain", &(noise.mGain), 0.1, 10, 0.1);
+            settingsChanged |= add_option_float(ctx, "Lacunarity", &(noise.mLacunarity), 0.1, 10, 0.1);
 
             // Extra Cellular settings
             if (noise.mNoiseType == noise.NoiseType_Cellular){
                 add_option_separator(ctx, "Cellular Settings");
-                add_option_list(ctx, "Distance Function", (int*)&(noise.mCellularDistanceFunction), cellularDistanceFuncs);
-                add_option_list(ctx, "Return Type", (int*)&(noise.mCellularReturnType), cellularReturnTypes);
+                settingsChanged |= add_option_list(ctx, "Distance Function", (int*)&(noise.mCellularDistanceFunction), cellularDistanceFuncs);
+                settingsChanged |= add_option_list(ctx, "Return Type", (int*)&(noise.mCellularReturnType), cellularReturnTypes);
             }
 
             // Extra Fractal Settings
             if (noiseMod == 1){
                 add_option_separator(ctx, "Fractal Settings");
-                add_option_list(ctx, "Fractal Type", (int*)&(noise.mFractalType), fractals);
-                add_option_int(ctx, "Noise Octaves", &(noise.mOctaves), 1, 50, 1);
+                settingsChanged |= add_option_list(ctx, "Fractal Type", (int*)&(noise.mFractalType), fractals);
+                settingsChanged |= add_option_int(ctx, "Noise Octaves", &(noise.mOctaves), 1, 50, 1);
                 noise.CalculateFractalBounding(); // Recalculate bounding since octaves changed
-                add_option_float(ctx, "Weighted Strength", &(noise.mWeightedStrength), 0, 25, 0.1);
+                settingsChanged |= add_option_float(ctx, "Weighted Strength", &(noise.mWeightedStrength), 0, 25, 0.1);
             }
 
             // Extra Domain Warp Settings
             if ((int)(noise.mFractalType) > 3 && noiseMod == 1){
                 add_option_separator(ctx, "Domain Warp Settings");
-                add_option_list(ctx, "Warp Type", &warpType, warpTypes);
+                settingsChanged |= add_option_list(ctx, "Warp Type", &warpType, warpTypes);
                 noise.SetDomainWarpType((FastNoiseLite::DomainWarpType)warpType);
-                add_option_float(ctx, "Warp Amplifier", &(noise.mDomainWarpAmp), 0.1, 2, 0.1);
+                settingsChanged |= add_option_float(ctx, "Warp Amplifier", &(noise.mDomainWarpAmp), 0.1, 2, 0.1);
             }
         }
         nk_end(ctx);
+
+        add_profiler_window(ctx, profiler, noiseStage);
+        guiTimer.stop();
         //----------------------------------------------------------------------------------
 
 
@@ -247,71 +339,142 @@ int main(int argc, char* argv[])
 
             BeginMode3D(camera); // Set camera to 3d mode to draw cubes
 
-                for (float x = 0; x < cubeSize.x*noiseSampleScale; x += noiseSampleScale){          // Iterate x dimension of the cube
-                    for (float y = 0; y < cubeSize.y*noiseSampleScale; y += noiseSampleScale){      // Iterate y dimension of the cube
-                        for (float z = 0; z < cubeSize.z*noiseSampleScale; z += noiseSampleScale){  // Iterate z dimension of the cube
-                            //std::cout << FormatText("(%f, %f, %f), {0, 0, 0, %f}", x, y, z, 255*(noise.GetNoise(x, y, z)/2+0.5)) << std::endl;
-                            //_sleep(1000);
-
-                            if ( (camera.position.x <= 0 && x == 0) || (camera.position.x >= 0 && x == cubeSize.x*noiseSampleScale-noiseSampleScale) || y == cubeSize.y*noiseSampleScale-noiseSampleScale || (camera.position.z <= 0 && z == 0) || (camera.position.z >= 0 && z == cubeSize.z*noiseSampleScale-noiseSampleScale) ){ // Only run if point is on the side or top of the cube
-                                if ((int)(noise.mFractalType) > 3 && noiseMod == 1){
-                                    tmpXYZ = {x, y, z};
-                                    tmpYZW = {y, z, w};
-                                    tmpZWX = {z, w, x};
-                                    tmpWXY = {w, x, y};
-
-                                    noise.TransformDomainWarpCoordinate(tmpXYZ.x, tmpXYZ.y, tmpXYZ.z); // Get noise on the xyz plane
-                                    noise.TransformDomainWarpCoordinate(tmpYZW.x, tmpYZW.y, tmpYZW.z); // Get noise on the yzw plane
-                                    noise.TransformDomainWarpCoordinate(tmpZWX.x, tmpZWX.y, tmpZWX.z); // Get noise on the zwx plane
-                                    noise.TransformDomainWarpCoordinate(tmpWXY.x, tmpWXY.y, tmpWXY.z);  // Get noise on the wxy plane
-                                    
-                                    averagedNoise = (
-                                        noise.GetNoise(tmpXYZ.x, tmpXYZ.y, tmpXYZ.z) + // Get noise on the xyz plane
-                                        noise.GetNoise(tmpYZW.x, tmpYZW.y, tmpYZW.z) + // Get noise on the yzw plane
-                                        noise.GetNoise(tmpZWX.x, tmpZWX.y, tmpZWX.z) + // Get noise on the zwx plane
-                                        noise.GetNoise(tmpWXY.x, tmpWXY.y, tmpWXY.z)   // Get noise on the wxy plane
-                                    )/4; // Average the 4 planes to get a value
-                                } else {
-                                    averagedNoise = (
-                                        noise.GetNoise(x, y, z) + // Get noise on the xyz plane
-                                        noise.GetNoise(y, z, w) + // Get noise on the yzw plane
-                                        noise.GetNoise(z, w, x) + // Get noise on the zwx plane
-                                        noise.GetNoise(w, x, y)   // Get noise on the wxy plane
-                                    )/4; // Average the 4 planes to get a value
+                int sizeX = (int)cubeSize.x, sizeY = (int)cubeSize.y, sizeZ = (int)cubeSize.z;
+
+                if (settingsChanged){
+                    settingsVersion++;
+                    settingsChanged = false;
+                }
+                NoiseVolumeKey volumeKey = {0, sizeX, sizeY, sizeZ, noiseSampleScale, noiseMod, settingsVersion, 1};
+
+                // While settings are being dragged slow volumes are previewed, 1/4 or 1/8 of the voxels along each side of a face
+                // are sampled and repeated in between, full resolution follows a quarter second after the last change
+                if (!(volumeKey == lastKey)){
+                    // A full resolution job can take seconds, cancel it at the first change instead of waiting for it before the preview starts
+                    // Previews are quick so they are left to finish while dragging, cancelling them every frame would show nothing until the drag stops
+                    if (previewFrames == 0) generator.setGeneration(++generation);
+                    previewFrames = 15;
+                }
+                lastKey = volumeKey;
+                if (previewFrames > 0){
+                    previewFrames--;
+                    volumeKey.stride = fullVolumeMs <= 16 ? 1 : fullVolumeMs <= 16*16 ? 4 : 8; // Sampling cost goes down with the square of the stride
+                }
+                volumeKey.w = w;
+
+                // Find the faces of the cube that can be seen, a face is seen when the camera is on the outside of its plane
+                // Voxels are centered on whole numbers so the cube spans -0.5 to size-0.5, at most 3 faces are seen at once
+                bool faceVisible[5] = {
+                    camera.position.x < -0.5f,
+                    camera.position.x > sizeX-0.5f,
+                    camera.position.y > sizeY-0.5f,
+                    camera.position.z < -0.5f,
+                    camera.position.z > sizeZ-0.5f
+                };
+
+                bool colorsChanged = colormap.configure(palette); // A new palette only needs the mesh recolored, not new samples
+                if (colorsChanged) raymarcher.setPalette(colormap);
+
+                double volumeMs, volumeSamples;
+                if (generator.finish(volume, volumeMs, volumeSamples)){ // A newer volume is ready, draw it from now on
+                    profiler.add(noiseStage, volumeMs, volumeSamples);
+                    if (volume.key.stride == 1 && volumeSamples > 0) fullVolumeMs = volumeMs;
+                    colorsChanged = true;
+                    raymarchCurrent = false;
+                }
+
+                bool volumeCurrent = volume.key == volumeKey;
+                for (int f = 0; f < 5; f++){
+                    if (faceVisible[f] && !volume.faceSampled[f]) volumeCurrent = false;
+                }
+                if (renderMode == 1 && !volume.interiorSampled) volumeCurrent = false; // Raymarching needs every voxel
+
+                if (!volumeCurrent && !generator.busy()){ // Sample the current settings and w in the background, the old volume is drawn until then
+                    VolumeRequest request = {noise, volumeKey, {}, (int)(noise.mFractalType) > 3 && noiseMod == 1, generation, renderMode == 1};
+                    std::copy(faceVisible, faceVisible+5, request.faces);
+                    generator.start(request, volume);
+                }
+
+                if (renderMode == 0){
+                    // The mesh shows the faces of the drawn volume, which can be a few frames behind the camera and settings
+                    CubeFace faces[5];
+                    cubeFaces(volume.key.sizeX, volume.key.sizeY, volume.key.sizeZ, faces);
+                    bool shownFaces[5]; // An interior volume has every face sampled, still only the ones facing the camera are laid out
+                    for (int f = 0; f < 5; f++) shownFaces[f] = volume.faceSampled[f] && faceVisible[f];
+
+                    if (volume.key.sizeX != meshSize[0] || volume.key.sizeY != meshSize[1] || volume.key.sizeZ != meshSize[2] || !std::equal(shownFaces, shownFaces+5, meshFaces)){ // Shown faces changed, lay out the voxel sides again
+                        Profiler::Scope meshTimer(profiler, meshStage);
+                        voxelSides.clear();
+                        for (int f = 0; f < 5; f++){
+                            if (!shownFaces[f]) continue;
+                            CubeFace face = faces[f];
+
+                            for (int z = face.z; z < face.z+face.sizeZ; z++){
+                                for (int y = face.y; y < face.y+face.sizeY; y++){
+                                    for (int x = face.x; x < face.x+face.sizeX; x++){
+                                        voxelSides.push_back({{(float)x, (float)y, (float)z}, face.axis, face.direction}); // Only the side facing out of the cube can be seen
+                                    }
                                 }
+                            }
+                        }
+
+                        voxelMesh.setSides(voxelSides);
+                        meshSize[0] = volume.key.sizeX; meshSize[1] = volume.key.sizeY; meshSize[2] = volume.key.sizeZ;
+                        std::copy(shownFaces, shownFaces+5, meshFaces);
+                        colorsChanged = true;
+                    }
 
-                                rgbColor color = hsv2rgb({averagedNoise*180+180, 0.5, 0.5, 0.5}); // Convert value to hsv, then to rgb, with the value as the hue
-                                        
-                                DrawCube( // Draw cube
-                                    {x/noiseSampleScale, y/noiseSampleScale, z/noiseSampleScale}, // Set draw location
-                                    1, 1, 1, // Cube is 1x1x1
-                                    {(unsigned char)(color.r*255), (unsigned char)(color.g*255), (unsigned char)(color.b*255), 255} // Set color to the computed rgb with no transparency
-                                );
+                    if (colorsChanged){ // Recolor the mesh from the samples, same side order as the layout
+                        Profiler::Scope colorTimer(profiler, colorStage);
+                        Color rowColors[250]; // Longest row the cube size sliders allow
+                        int side = 0;
+                        for (int f = 0; f < 5; f++){
+                            if (!shownFaces[f]) continue;
+                            CubeFace face = faces[f];
+
+                            for (int z = face.z; z < face.z+face.sizeZ; z++){          // Iterate z dimension of the face
+                                for (int y = face.y; y < face.y+face.sizeY; y++){      // Iterate y dimension of the face
+                                    colormap.mapCodes(volume.at(face.x, y, z), (unsigned char*)rowColors, face.sizeX, volume.range); // Whole row of the face as table lookups
+                                    voxelMesh.setColors(side, rowColors, face.sizeX);
+                                    side += face.sizeX;
+                                }
                             }
                         }
+
+                        voxelMesh.uploadColors();
+                    }
+
+                    Profiler::Scope drawTimer(profiler, drawStage);
+                    voxelMesh.draw(); // Draw every visible voxel side at once
+                    drawTimer.stop();
+                } else {
+                    voxelMesh.clear(); // Not needed while raymarching, laid out again when switching back
+                    meshSize[0] = meshSize[1] = meshSize[2] = 0;
+
+                    if (!raymarchCurrent && volume.interiorSampled){ // Send each new volume to the gpu once
+                        Profiler::Scope uploadTimer(profiler, colorStage);
+                        raymarcher.upload(volume);
+                        raymarchCurrent = true;
                     }
-                }
 
-                // to do 3d given 2d and an x, y, and z, you would take these planes and combine each point through averaging:
-                // x, y
-                // y, z
-                // z, x
+                    Profiler::Scope drawTimer(profiler, drawStage);
+                    raymarcher.draw(camera, threshold, opacity); // Per frame cost depends on the screen size, not the voxel count
+                }
 
-                // so for 4d give z, y, z, and w, you would take these planes  and combine each point through averaging:
-                // x, y, z
-                // y, z, w
-                // z, w, x
-                // w, x, y
+                // w is the 4th dimension, while Animate W is on each new volume shows the next xyz slice of the 4d noise
 
                 //std::cout << "Frame " << w << " rendered (" << cosf(camAngle*PI/180)*15.0f << ", " << sinf(camAngle*PI/180)*15.0f << ")" << std::endl;
 
-                w++; // Increase w dimension by one
+                if (animateW && volume.key.w == w) w++; // Increase w dimension by one once the slice at w is drawn, so slow volumes don't skip slices
             
             EndMode3D(); // Stop 3d mode
 
             DrawFPS(nk_window_is_collapsed(ctx, "Config") ? 38 : 240, 10); // Draw fps indicator
 
-            nk_raylib_render(ctx); // Draw Nuklear Windows
+            {
+                Profiler::Scope renderTimer(profiler, guiDrawStage);
+                nk_raylib_render(ctx); // Draw Nuklear Windows
+            }
 
         EndDrawing(); // Stop drawing and display what was drawn
         //----------------------------------------------------------------------------------
@@ -319,10 +482,15 @@ int main(int argc, char* argv[])
         if (WindowShouldClose()){
             exitNow = true;
         }
+
+        frameTimer.stop();
+        profiler.endFrame();
     }
 
     // De-Initialization
     //--------------------------------------------------------------------------------------   
+    voxelMesh.clear();    // Free the mesh while there is still an OpenGL context
+    raymarcher.clear();   // Same for the shader and textures
     CloseWindow();        // Close window and OpenGL context
     //--------------------------------------------------------------------------------------
 
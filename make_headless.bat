@@ -0,0 +1,44 @@
+@echo off
+setlocal EnableExtensions DisableDelayedExpansion
+
+:: .
+:: Compile command line tools that don't use raylib, like noise_bake.cpp, using:  make_headless.bat noise_bake.cpp
+:: .
+:: > Setup required Environment
+:: -------------------------------------
+set COMPILER="g++.exe"
+
+where /q %COMPILER%
+if errorlevel 1 (
+echo "TDM-GCC, MINGW, or some other g++ distribution for windows, must be installed and on path"
+exit /B
+)
+
+
+:: Get full filename path for input file %1
+set FILENAME=%~f1
+set NAMEPART=%FILENAME:~0,-4%
+cd %~dp0
+
+:: .
+:: > Cleaning latest build
+:: ---------------------------
+cmd /c if exist %NAMEPART%.x86.exe del /F %NAMEPART%.x86.exe
+
+:: .
+:: > Compiling program
+:: --------------------------
+:: -s: Remove all symbol table and relocation information from the executable
+:: -Ofast : Optimization level above O3, also allows faster float math
+:: -Wall : Enable all compilation Warnings
+:: No -mwindows, these are console programs
+%COMPILER% %FILENAME% -o %NAMEPART%.x86.exe -s -Ofast -std=c++17 -Wall -m32 -mthreads -static -fdata-sections -ffunction-sections -Wl,--gc-sections
+
+
+:: Ensure dirs for built exes
+mkdir bin\x86
+
+:: Move builds to respective binary directories
+move %NAMEPART%.x86.exe bin\x86
+
+endlocal
@@ -0,0 +1,105 @@
+/*******************************************************************************************
+*
+*   NaN check
+*
+*   Pushes NaN through the quantize step and the colormap the explorer and baker use and checks
+*   it comes out as the lowest code or first color instead of whatever the float to int conversion
+*   makes of it
+*
+*   Build with make_headless.bat so it runs under the shipped flags, -Ofast assumes there are
+*   no NaNs and can drop checks written as float compares, or on other platforms with
+*       g++ nan_check.cpp -o nan_check -Ofast -std=c++17
+*
+*   Prints every failed case and exits with 1 if there were any
+*
+********************************************************************************************/
+
+#include "quantize.h" // Float to 8 and 16 bit codes
+#include "colormap.h" // Noise values to colors
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+static int failures = 0;
+
+static void check(bool passed, const char* name, int count, int position)
+{
+    if (passed) return;
+    printf("FAILED %s, %d values, NaN at %d\n", name, count, position);
+    failures++;
+}
+
+// volatile so the compiler can't see the NaN coming and fold it away
+static float makeNaN()
+{
+    volatile float zero = 0;
+    return zero/zero;
+}
+
+template<typename T>
+static void checkQuantize(const char* name, float nan)
+{
+    QuantizeRange range = QuantizeRange::between(-1, 1, std::numeric_limits<T>::max());
+    float half = 0.5f;
+    T halfCode;
+    quantizeRow(&half, &halfCode, 1, range);
+
+    // Long enough rows for the vectorized loop body as well as the leftovers after it
+    for (int count : {1, 7, 37, 256}){
+        for (int position = 0; position < count; position += count > 8 ? 5 : 1){
+            std::vector<float> values(count, 0.5f);
+            std::vector<T> codes(count);
+            values[position] = nan;
+
+            quantizeRow(values.data(), codes.data(), count, range);
+            bool passed = true;
+            for (int i = 0; i < count; i++){
+                if (codes[i] != (i == position ? 0 : halfCode)) passed = false;
+            }
+            check(passed, name, count, position);
+        }
+    }
+}
+
+static void checkColormap(const char* name, float nan)
+{
+    Colormap colormap;
+    colormap.configure(ColormapPalette_Grayscale);
+
+    float lowest = -1;
+    unsigned char first[4];
+    colormap.mapValues(&lowest, first, 1);
+
+    for (int count : {1, 7, 37, 256}){
+        for (int position = 0; position < count; position += count > 8 ? 5 : 1){
+            std::vector<float> values(count, 1.0f);
+            std::vector<unsigned char> rgba(count*4);
+            values[position] = nan;
+
+            colormap.mapValues(values.data(), rgba.data(), count);
+            check(memcmp(&rgba[position*4], first, 4) == 0, name, count, position);
+        }
+    }
+}
+
+int main()
+{
+    float nan = makeNaN();
+    float negativeNaN = -nan;
+
+    checkQuantize<uint8_t>("quantizeRow 8 bit", nan);
+    checkQuantize<uint16_t>("quantizeRow 16 bit", nan);
+    checkQuantize<uint8_t>("quantizeRow 8 bit, negative NaN", negativeNaN);
+    checkQuantize<uint16_t>("quantizeRow 16 bit, negative NaN", negativeNaN);
+    checkColormap("Colormap", nan);
+    checkColormap("Colormap, negative NaN", negativeNaN);
+
+    if (failures > 0){
+        printf("%d failed\n", failures);
+        return 1;
+    }
+    printf("All passed\n");
+    return 0;
+}
@@ -0,0 +1,337 @@
+/*******************************************************************************************
+*
+*   Headless noise baker
+*
+*   Samples the same 4D noise as the explorer for a whole cube at a range of w values and
+*   writes it to disk, no window or gpu needed so it can run on build servers
+*
+*   Build with make_headless.bat, or on other platforms with
+*       g++ noise_bake.cpp -o noise_bake -O3 -std=c++17 -pthread
+*
+*   Output is either raw 32 bit floats, x changes fastest then y, z and w, or a chunked
+*   volume file (volume_file.h) of 32^3 bricks as floats or quantized to 8 or 16 bits
+*
+*   Slices are streamed out as they are sampled, memory use depends on the slice size and
+*   --queue depth but not on how many w values are baked
+*
+********************************************************************************************/
+
+#include "FastNoiseLite.hpp" // FastNoiseLite library for generating noise
+#include "thread_pool.h" // Worker threads for sampling noise
+#include "tile_scheduler.h" // Balances tiles of the volume between the threads
+#include "bounded_queue.h" // Hands sampled slices to the writer thread
+#include "volume_file.h" // Chunked volume output
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct BakeSettings {
+    int sizeX = 50, sizeY = 50, sizeZ = 50;
+    int sampleScale = 10;
+    float wStart = 0, wEnd = 0, wStep = 1; // w values from wStart up to and including wEnd
+    int threads = 0; // 0 uses every core
+    int queueDepth = 2; // Raw slices held in memory at once, sampling waits when the writer falls this far behind
+    std::string outPath = "noise.raw";
+    int format = -1; // -1 for raw floats, otherwise a VolumeFormat for a chunked volume file
+    float rangeMin = -1, rangeMax = 1; // Values mapped to the ends of the quantized range
+};
+
+// Names match the lists in the explorer gui, lower case and without spaces
+const char* noiseNames[] = { "opensimplex2", "opensimplex2s", "cellular", "perlin", "valuecubic", "value" };
+const char* fractalNames[] = { "none", "fbm", "ridged", "pingpong", "domainwarpprogressive", "domainwarpindependent" };
+const char* cellularDistanceNames[] = { "euclidean", "euclideansq", "manhattan", "hybrid" };
+const char* cellularReturnNames[] = { "cellvalue", "distance", "distance2", "distance2add", "distance2sub", "distance2mul", "distance2div" };
+const char* warpNames[] = { "opensimplex2", "opensimplex2reduced", "basicgrid" };
+const char* formatNames[] = { "raw", "f32", "u8", "u16" }; // Index - 1 is the VolumeFormat
+
+void printUsage(){
+    printf(
+        "Usage: noise_bake [options]\n"
+        "  --out <file>               Output file (noise.raw)\n"
+        "  --format <type>            raw for plain floats, f32, u8 or u16 for a chunked volume file (raw)\n"
+        "  --range <min> <max>        Values stored at the ends of the u8/u16 range, others are clamped (-1 1)\n"
+        "  --size <n>                 Cube size on every axis (50)\n"
+        "  --size-x/--size-y/--size-z <n>\n"
+        "  --sample-scale <n>         Distance between voxels in noise space (10)\n"
+        "  --w-start <f> --w-end <f> --w-step <f>\n"
+        "                             w values to bake, end is included (0 0 1)\n"
+        "  --threads <n>              Worker threads, 0 for every core (0)\n"
+        "  --queue <n>                Raw slices kept in memory while waiting to be written (2)\n"
+        "  --seed <n>                 (1337)\n"
+        "  --noise <type>             opensimplex2, opensimplex2s, cellular, perlin, valuecubic, value (opensimplex2s)\n"
+        "  --frequency <f>            (0.01)\n"
+        "  --fractal <type>           none, fbm, ridged, pingpong, domainwarpprogressive, domainwarpindependent (none)\n"
+        "  --octaves <n> --gain <f> --lacunarity <f> --weighted-strength <f>\n"
+        "  --cellular-distance <type> euclidean, euclideansq, manhattan, hybrid\n"
+        "  --cellular-return <type>   cellvalue, distance, distance2, distance2add, distance2sub, distance2mul, distance2div\n"
+        "  --warp <type>              opensimplex2, opensimplex2reduced, basicgrid\n"
+        "  --warp-amp <f>\n"
+    );
+}
+
+// Accepts a name from the list or its index, exits on anything else
+int parseEnum(const char* option, const char* value, const char** names, int count){
+    for (int i = 0; i < count; i++){
+        if (strcmp(value, names[i]) == 0) return i;
+    }
+
+    char* end;
+    long index = strtol(value, &end, 10);
+    if (*end == 0 && end != value && index >= 0 && index < count) return (int)index;
+
+    fprintf(stderr, "Unknown value '%s' for %s\n", value, option);
+    exit(1);
+}
+
+bool parseArgs(int argc, char* argv[], BakeSettings& settings, FastNoiseLite& noise){
+    for (int i = 1; i < argc; i++){
+        const char* option = argv[i];
+        if (strcmp(option, "--help") == 0 || strcmp(option, "-h") == 0) return false;
+
+        if (i+1 >= argc){
+            fprintf(stderr, "Missing value for %s\n", option);
+            return false;
+        }
+        const char* value = argv[++i];
+
+        if (strcmp(option, "--out") == 0) settings.outPath = value;
+        else if (strcmp(option, "--format") == 0) settings.format = parseEnum(option, value, formatNames, 4) - 1;
+        else if (strcmp(option, "--range") == 0){
+            if (i+1 >= argc){
+                fprintf(stderr, "Missing value for %s\n", option);
+                return false;
+            }
+            settings.rangeMin = (float)atof(value);
+            settings.rangeMax = (float)atof(argv[++i]);
+        }
+        else if (strcmp(option, "--size") == 0) settings.sizeX = settings.sizeY = settings.sizeZ = atoi(value);
+        else if (strcmp(option, "--size-x") == 0) settings.sizeX = atoi(value);
+        else if (strcmp(option, "--size-y") == 0) settings.sizeY = atoi(value);
+        else if (strcmp(option, "--size-z") == 0) settings.sizeZ = atoi(value);
+        else if (strcmp(option, "--sample-scale") == 0) settings.sampleScale = atoi(value);
+        else if (strcmp(option, "--w-start") == 0) settings.wStart = (float)atof(value);
+        else if (strcmp(option, "--w-end") == 0) settings.wEnd = (float)atof(value);
+        else if (strcmp(option, "--w-step") == 0) settings.wStep = (float)atof(value);
+        else if (strcmp(option, "--threads") == 0) settings.threads = atoi(value);
+        else if (strcmp(option, "--queue") == 0) settings.queueDepth = atoi(value);
+        else if (strcmp(option, "--seed") == 0) noise.SetSeed(atoi(value));
+        else if (strcmp(option, "--noise") == 0) noise.SetNoiseType((FastNoiseLite::NoiseType)parseEnum(option, value, noiseNames, 6));
+        else if (strcmp(option, "--frequency") == 0) noise.SetFrequency((float)atof(value));
+        else if (strcmp(option, "--fractal") == 0) noise.SetFractalType((FastNoiseLite::FractalType)parseEnum(option, value, fractalNames, 6));
+        else if (strcmp(option, "--octaves") == 0) noise.SetFractalOctaves(atoi(value));
+        else if (strcmp(option, "--gain") == 0) noise.SetFractalGain((float)atof(value));
+        else if (strcmp(option, "--lacunarity") == 0) noise.SetFractalLacunarity((float)atof(value));
+        else if (strcmp(option, "--weighted-strength") == 0) noise.SetFractalWeightedStrength((float)atof(value));
+        else if (strcmp(option, "--cellular-distance") == 0) noise.SetCellularDistanceFunction((FastNoiseLite::CellularDistanceFunction)parseEnum(option, value, cellularDistanceNames, 4));
+        else if (strcmp(option, "--cellular-return") == 0) noise.SetCellularReturnType((FastNoiseLite::CellularReturnType)parseEnum(option, value, cellularReturnNames, 7));
+        else if (strcmp(option, "--warp") == 0) noise.SetDomainWarpType((FastNoiseLite::DomainWarpType)parseEnum(option, value, warpNames, 3));
+        else if (strcmp(option, "--warp-amp") == 0) noise.SetDomainWarpAmp((float)atof(value));
+        else {
+            fprintf(stderr, "Unknown option %s\n", option);
+            return false;
+        }
+    }
+
+    if (settings.sizeX < 1 || settings.sizeY < 1 || settings.sizeZ < 1 || settings.wStep <= 0 || settings.wEnd < settings.wStart){
+        fprintf(stderr, "Sizes must be at least 1, w step above 0 and w end not below w start\n");
+        return false;
+    }
+    if (settings.queueDepth < 1){
+        fprintf(stderr, "Queue depth must be at least 1\n");
+        return false;
+    }
+    if (settings.rangeMax <= settings.rangeMin){
+        fprintf(stderr, "Range max must be above range min\n");
+        return false;
+    }
+    return true;
+}
+
+struct Sampler { // Same sampling as the explorer so baked volumes match what is shown
+    FastNoiseLite& noise;
+    FastNoiseLite::UniformGrid4DKernel gridKernel;
+    bool warpPoints;
+    int scale;
+
+    Sampler(FastNoiseLite& noise, int scale) : noise(noise), scale(scale) {
+        gridKernel = noise.GetUniformGrid4DKernel();
+        warpPoints = noise.mFractalType == FastNoiseLite::FractalType_DomainWarpProgressive || noise.mFractalType == FastNoiseLite::FractalType_DomainWarpIndependent;
+    }
+
+    // A row of voxels along x starting at voxel (x, y, z)
+    void row(float* out, int x, int y, int z, int length, float w){
+        if (warpPoints){
+            for (int i = x; i < x+length; i++){
+                float wx = (float)i*scale, wy = (float)y*scale, wz = (float)z*scale;
+
+                noise.TransformDomainWarpCoordinate(wx, wy, wz); // Warp the xyz part the same way the explorer does, w is left as is
+
+                *out++ = noise.GetNoise(wx, wy, wz, w);
+            }
+        } else {
+            gridKernel(noise, out, (float)x*scale, (float)y*scale, (float)z*scale, w, length, 1, 1, 1, (float)scale);
+        }
+    }
+};
+
+// One xyz slice at w as plain floats
+void bakeSlice(Sampler& sampler, TileScheduler& scheduler, const BakeSettings& settings, float w, float* out){
+    int tileSize = TileScheduler::DefaultTileSize;
+    scheduler.run(settings.sizeX, settings.sizeY, settings.sizeZ, tileSize, tileSize, tileSize, [&](const Tile& tile){
+        for (int z = tile.z0; z < tile.z1; z++){
+            for (int y = tile.y0; y < tile.y1; y++){
+                sampler.row(out + ((size_t)z*settings.sizeY + y)*settings.sizeX + tile.x0, tile.x0, y, z, tile.x1-tile.x0, w);
+            }
+        }
+    });
+}
+
+// One xyz slice at w into the bricks of a volume file, each task samples and writes one brick
+bool bakeBricks(Sampler& sampler, TileScheduler& scheduler, VolumeFile& volume, int slice, float w){
+    const VolumeFileHeader& header = volume.header;
+    std::atomic<bool> failed{false};
+
+    scheduler.run(header.sizeX, header.sizeY, header.sizeZ, VolumeBrickSize, VolumeBrickSize, VolumeBrickSize, [&](const Tile& tile){ // Tiles are whole bricks
+        int bx = tile.x0/VolumeBrickSize, by = tile.y0/VolumeBrickSize, bz = tile.z0/VolumeBrickSize;
+        int x0 = tile.x0, y0 = tile.y0, z0 = tile.z0;
+        int sizeX = tile.x1 - x0, sizeY = tile.y1 - y0, sizeZ = tile.z1 - z0;
+
+        std::vector<float> values(VolumeBrickVoxels, 0.0f); // Voxels past the end of the volume stay 0
+        for (int z = 0; z < sizeZ; z++){
+            for (int y = 0; y < sizeY; y++){
+                sampler.row(values.data() + (z*VolumeBrickSize + y)*VolumeBrickSize, x0, y0+y, z0+z, sizeX, w);
+            }
+        }
+
+        if (!volume.writeBrick(bx, by, bz, slice, values.data())) failed = true;
+    });
+
+    return !failed;
+}
+
+int main(int argc, char* argv[])
+{
+    BakeSettings settings;
+    FastNoiseLite noise;
+    noise.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2S); // Same default as the explorer
+
+    if (!parseArgs(argc, argv, settings, noise)){
+        printUsage();
+        return 1;
+    }
+
+    int sliceCount = (int)((settings.wEnd - settings.wStart)/settings.wStep) + 1;
+    FILE* file = nullptr;
+    VolumeFile volume;
+    bool opened;
+
+    if (settings.format < 0){
+        file = fopen(settings.outPath.c_str(), "wb");
+        opened = file != nullptr;
+    } else {
+        VolumeFileHeader header = {};
+        header.format = settings.format;
+        header.sizeX = settings.sizeX;
+        header.sizeY = settings.sizeY;
+        header.sizeZ = settings.sizeZ;
+        header.sizeW = sliceCount;
+        header.quantScale = 1;
+        header.quantOffset = 0;
+        if (settings.format != VolumeFormat_Float32){
+            QuantizeRange range = QuantizeRange::between(settings.rangeMin, settings.rangeMax, settings.format == VolumeFormat_UInt8 ? 255 : 65535);
+            header.quantScale = range.scale;
+            header.quantOffset = range.offset;
+        }
+        header.sampleScale = (float)settings.sampleScale;
+        header.wStart = settings.wStart;
+        header.wStep = settings.wStep;
+
+        opened = volume.create(settings.outPath, header, NoiseConfig::from(noise));
+    }
+
+    if (!opened){
+        fprintf(stderr, "Could not open %s for writing\n", settings.outPath.c_str());
+        return 1;
+    }
+
+    ThreadPool pool(settings.threads);
+    TileScheduler scheduler(pool);
+    Sampler sampler(noise, settings.sampleScale);
+    size_t sliceSize = (size_t)settings.sizeX*settings.sizeY*settings.sizeZ;
+
+    printf("Baking %d slices of %dx%dx%d as %s on %d threads to %s\n", sliceCount, settings.sizeX, settings.sizeY, settings.sizeZ, formatNames[settings.format + 1], pool.ThreadCount(), settings.outPath.c_str());
+
+    double sampleSeconds = 0;
+    std::atomic<bool> failed{false}; // Set by the writer thread too
+    auto start = std::chrono::steady_clock::now();
+
+    if (settings.format >= 0){
+        // Bricks are sampled and written together by the workers, only one brick per worker is ever in memory
+        for (int i = 0; i < sliceCount && !failed; i++){
+            auto sampleStart = std::chrono::steady_clock::now();
+            if (!bakeBricks(sampler, scheduler, volume, i, settings.wStart + i*settings.wStep)){
+                fprintf(stderr, "Failed writing slice %d to %s\n", i, settings.outPath.c_str());
+                failed = true;
+            }
+            sampleSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - sampleStart).count();
+        }
+
+        if (!volume.close()){ // Bricks are only written back to the disk here
+            fprintf(stderr, "Failed writing %s\n", settings.outPath.c_str());
+            failed = true;
+        }
+    } else {
+        // The pool samples the next slices while the writer thread writes the finished ones
+        // Slice buffers go round between the two queues, so there are never more than queueDepth of them
+        struct SampledSlice { int slice; int buffer; };
+        std::vector<std::vector<float>> buffers(settings.queueDepth, std::vector<float>(sliceSize));
+        BoundedQueue<int> freeBuffers(settings.queueDepth);
+        BoundedQueue<SampledSlice> sampled(settings.queueDepth);
+        for (int i = 0; i < settings.queueDepth; i++) freeBuffers.push(i);
+
+        std::thread writer([&]{
+            SampledSlice item;
+            while (sampled.pop(item)){
+                if (fwrite(buffers[item.buffer].data(), sizeof(float), sliceSize, file) != sliceSize){
+                    fprintf(stderr, "Failed writing slice %d to %s\n", item.slice, settings.outPath.c_str());
+                    failed = true;
+                    freeBuffers.close(); // Stops sampling, nothing after this slice can be written
+                    return;
+                }
+                freeBuffers.push(item.buffer);
+            }
+        });
+
+        int buffer;
+        // Waits here while every buffer is queued for writing, buffers still queued after a write failed aren't sampled into
+        for (int i = 0; i < sliceCount && freeBuffers.pop(buffer) && !failed; i++){
+            auto sampleStart = std::chrono::steady_clock::now();
+            bakeSlice(sampler, scheduler, settings, settings.wStart + i*settings.wStep, buffers[buffer].data());
+            sampleSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - sampleStart).count();
+
+            sampled.push({i, buffer});
+        }
+
+        sampled.close();
+        writer.join();
+        if (fclose(file) != 0){ // Buffered writes can still fail here, on a full disk the file would be cut short
+            fprintf(stderr, "Failed writing %s\n", settings.outPath.c_str());
+            failed = true;
+        }
+    }
+
+    if (failed) return 1;
+
+    double totalSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double samples = (double)sliceSize*sliceCount;
+    printf("Wrote %.0f samples in %.3fs, %.2f million samples/sec sampling, %.2f million samples/sec overall\n",
+        samples, totalSeconds, samples/sampleSeconds/1e6, samples/totalSeconds/1e6);
+
+    return 0;
+}
@@ -0,0 +1,269 @@
+/*******************************************************************************************
+*
+*   FastNoiseLite benchmark
+*
+*   Times every noise type, fractal type, domain warp type and cellular setting in 2D and 3D,
+*   with float and double coordinates, walking a grid and jumping between random points,
+*   plus the specialized uniform grid kernels, and writes the results as JSON
+*
+*   Build with make_headless.bat, or on other platforms with
+*       g++ noise_bench.cpp -o noise_bench -O3 -std=c++17
+*
+*   Runs on a single thread, compare results from the same machine only
+*
+********************************************************************************************/
+
+#include "FastNoiseLite.hpp" // FastNoiseLite library for generating noise
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+struct BenchSettings {
+    int samples = 16384; // Points per timed pass
+    double minMs = 20;   // Passes are repeated until this much time has gone by, the fastest pass is kept
+    int octaves = 3;     // Octaves for fractal cases
+    std::string outPath; // Empty for stdout
+    std::string filter;  // Only cases whose name contains this are run
+};
+
+// Same names as noise_bake
+const char* noiseNames[] = { "opensimplex2", "opensimplex2s", "cellular", "perlin", "valuecubic", "value" };
+const char* fractalNames[] = { "none", "fbm", "ridged", "pingpong", "domainwarpprogressive", "domainwarpindependent" };
+const char* cellularDistanceNames[] = { "euclidean", "euclideansq", "manhattan", "hybrid" };
+const char* cellularReturnNames[] = { "cellvalue", "distance", "distance2", "distance2add", "distance2sub", "distance2mul", "distance2div" };
+const char* warpNames[] = { "opensimplex2", "opensimplex2reduced", "basicgrid" };
+
+enum BenchKind { BenchKind_Noise, BenchKind_Warp, BenchKind_UniformGrid };
+
+struct BenchCase {
+    BenchKind kind;
+    int noiseType, fractalType, warpType, cellularDistance, cellularReturn;
+    bool doubles;
+    int dims;
+    bool random; // Random points instead of walking a grid
+
+    std::string name() const {
+        std::string result = kind == BenchKind_Warp ? std::string("warp/") + warpNames[warpType] : std::string("noise/") + noiseNames[noiseType];
+        result += std::string("/") + fractalNames[fractalType];
+        if (kind == BenchKind_Noise && noiseType == FastNoiseLite::NoiseType_Cellular){
+            result += std::string("/") + cellularDistanceNames[cellularDistance] + "/" + cellularReturnNames[cellularReturn];
+        }
+        result += dims == 2 ? "/2d" : "/3d";
+        result += kind == BenchKind_UniformGrid ? "/uniformgrid" : random ? "/random" : "/grid";
+        result += doubles ? "/double" : "/float";
+        return result;
+    }
+};
+
+volatile float sink; // Results are summed into this so the compiler can't drop the work
+
+// Points for a pass, a grid walked x first or random points spread over the same area
+template<typename FNfloat>
+void makePoints(const BenchCase& bench, int count, std::vector<FNfloat>& points)
+{
+    int side = bench.dims == 2 ? (int)ceil(sqrt((double)count)) : (int)ceil(cbrt((double)count));
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<double> position(0, side*10.0);
+
+    points.resize((size_t)count*bench.dims);
+    for (int i = 0; i < count; i++){
+        for (int d = 0; d < bench.dims; d++){
+            int cell = d == 0 ? i%side : d == 1 ? i/side%side : i/(side*side);
+            points[(size_t)i*bench.dims + d] = (FNfloat)(bench.random ? position(random) : cell*10.0);
+        }
+    }
+}
+
+// Nanoseconds per point of the fastest pass
+template<typename FNfloat>
+double timeCase(FastNoiseLite& noise, const BenchCase& bench, const BenchSettings& settings)
+{
+    std::vector<FNfloat> points;
+    makePoints(bench, settings.samples, points);
+    int measured = settings.samples;
+
+    // Uniform grid cases fill a box of about the same number of points
+    FastNoiseLite::UniformGrid3DKernel gridKernel = noise.GetUniformGrid3DKernel();
+    int side = (int)ceil(cbrt((double)settings.samples));
+    int sizeZ = std::max(1, settings.samples/(side*side));
+    std::vector<float> grid;
+    if (bench.kind == BenchKind_UniformGrid){
+        measured = side*side*sizeZ;
+        grid.resize(measured);
+    }
+
+    double best = 1e30, totalMs = 0;
+
+    while (totalMs < settings.minMs || best == 1e30){
+        float sum = 0;
+        auto start = std::chrono::steady_clock::now();
+
+        if (bench.kind == BenchKind_UniformGrid){
+            gridKernel(noise, grid.data(), 0, 0, 0, side, side, sizeZ, 10);
+            sum = grid[measured - 1];
+        } else if (bench.kind == BenchKind_Warp){
+            for (int i = 0; i < settings.samples; i++){
+                FNfloat* p = &points[(size_t)i*bench.dims];
+                FNfloat x = p[0], y = p[1], z = bench.dims == 3 ? p[2] : 0;
+                if (bench.dims == 2) noise.DomainWarp(x, y);
+                else noise.DomainWarp(x, y, z);
+                sum += (float)(x + y + z);
+            }
+        } else if (bench.dims == 2){
+            for (int i = 0; i < settings.samples; i++) sum += noise.GetNoise(points[(size_t)i*2], points[(size_t)i*2 + 1]);
+        } else {
+            for (int i = 0; i < settings.samples; i++) sum += noise.GetNoise(points[(size_t)i*3], points[(size_t)i*3 + 1], points[(size_t)i*3 + 2]);
+        }
+
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        sink = sum;
+        totalMs += ms;
+        best = std::min(best, ms);
+    }
+
+    return best*1e6/measured;
+}
+
+std::vector<BenchCase> allCases()
+{
+    std::vector<BenchCase> cases;
+    const int noiseFractals[] = { FastNoiseLite::FractalType_None, FastNoiseLite::FractalType_FBm, FastNoiseLite::FractalType_Ridged, FastNoiseLite::FractalType_PingPong };
+    const int warpFractals[] = { FastNoiseLite::FractalType_None, FastNoiseLite::FractalType_DomainWarpProgressive, FastNoiseLite::FractalType_DomainWarpIndependent };
+
+    for (int dims = 2; dims <= 3; dims++){
+        for (int doubles = 0; doubles <= 1; doubles++){
+            for (int random = 0; random <= 1; random++){
+                for (int noiseType = 0; noiseType < 6; noiseType++){
+                    for (int fractal : noiseFractals){
+                        if (noiseType != FastNoiseLite::NoiseType_Cellular){
+                            cases.push_back({BenchKind_Noise, noiseType, fractal, 0, 0, 0, doubles != 0, dims, random != 0});
+                            continue;
+                        }
+
+                        // Every cellular setting without fractals, fractals only with the defaults
+                        for (int distance = 0; distance < 4; distance++){
+                            for (int returnType = 0; returnType < 7; returnType++){
+                                bool defaults = distance == FastNoiseLite::CellularDistanceFunction_EuclideanSq && returnType == FastNoiseLite::CellularReturnType_Distance;
+                                if (fractal != FastNoiseLite::FractalType_None && !defaults) continue;
+                                cases.push_back({BenchKind_Noise, noiseType, fractal, 0, distance, returnType, doubles != 0, dims, random != 0});
+                            }
+                        }
+                    }
+                }
+
+                for (int warpType = 0; warpType < 3; warpType++){
+                    for (int fractal : warpFractals){
+                        cases.push_back({BenchKind_Warp, 0, fractal, warpType, 0, 0, doubles != 0, dims, random != 0});
+                    }
+                }
+            }
+        }
+    }
+
+    // Grid kernels only take float coordinates and only have a 3D version
+    for (int noiseType = 0; noiseType < 6; noiseType++){
+        for (int fractal : noiseFractals){
+            cases.push_back({BenchKind_UniformGrid, noiseType, fractal, 0, FastNoiseLite::CellularDistanceFunction_EuclideanSq, FastNoiseLite::CellularReturnType_Distance, false, 3, false});
+        }
+    }
+
+    return cases;
+}
+
+void printUsage(){
+    printf(
+        "Usage: noise_bench [options]\n"
+        "  --out <file>               JSON output file, stdout if not given\n"
+        "  --filter <text>            Only run cases with this in their name, like noise/perlin or /3d/grid\n"
+        "  --samples <n>              Points per timed pass (16384)\n"
+        "  --min-ms <f>               Time spent repeating each case, the fastest pass is reported (20)\n"
+        "  --octaves <n>              Octaves for fractal cases (3)\n"
+        "  --list                     Print the case names and exit\n"
+    );
+}
+
+int main(int argc, char* argv[])
+{
+    BenchSettings settings;
+    bool listOnly = false;
+
+    for (int i = 1; i < argc; i++){
+        const char* option = argv[i];
+        if (strcmp(option, "--list") == 0){
+            listOnly = true;
+            continue;
+        }
+        if (strcmp(option, "--help") == 0 || strcmp(option, "-h") == 0 || i+1 >= argc){
+            printUsage();
+            return 1;
+        }
+        const char* value = argv[++i];
+
+        if (strcmp(option, "--out") == 0) settings.outPath = value;
+        else if (strcmp(option, "--filter") == 0) settings.filter = value;
+        else if (strcmp(option, "--samples") == 0) settings.samples = std::max(1, atoi(value));
+        else if (strcmp(option, "--min-ms") == 0) settings.minMs = atof(value);
+        else if (strcmp(option, "--octaves") == 0) settings.octaves = std::max(1, atoi(value));
+        else {
+            fprintf(stderr, "Unknown option %s\n", option);
+            printUsage();
+            return 1;
+        }
+    }
+
+    std::vector<BenchCase> cases;
+    for (const BenchCase& bench : allCases()){
+        if (bench.name().find(settings.filter) != std::string::npos) cases.push_back(bench);
+    }
+
+    if (listOnly){
+        for (const BenchCase& bench : cases) printf("%s\n", bench.name().c_str());
+        return 0;
+    }
+
+    FILE* out = settings.outPath.empty() ? stdout : fopen(settings.outPath.c_str(), "w");
+    if (!out){
+        fprintf(stderr, "Could not open %s for writing\n", settings.outPath.c_str());
+        return 1;
+    }
+
+    fprintf(out, "{\n  \"samples\": %d,\n  \"min_ms\": %g,\n  \"octaves\": %d,\n  \"results\": [\n", settings.samples, settings.minMs, settings.octaves);
+
+    for (size_t i = 0; i < cases.size(); i++){
+        const BenchCase& bench = cases[i];
+
+        FastNoiseLite noise;
+        noise.SetNoiseType((FastNoiseLite::NoiseType)bench.noiseType);
+        noise.SetFractalType((FastNoiseLite::FractalType)bench.fractalType);
+        noise.SetFractalOctaves(settings.octaves);
+        noise.SetCellularDistanceFunction((FastNoiseLite::CellularDistanceFunction)bench.cellularDistance);
+        noise.SetCellularReturnType((FastNoiseLite::CellularReturnType)bench.cellularReturn);
+        noise.SetDomainWarpType((FastNoiseLite::DomainWarpType)bench.warpType);
+
+        double ns = bench.doubles ? timeCase<double>(noise, bench, settings) : timeCase<float>(noise, bench, settings);
+
+        const char* kinds[] = { "noise", "warp", "uniformgrid" };
+        bool cellular = bench.kind != BenchKind_Warp && bench.noiseType == FastNoiseLite::NoiseType_Cellular;
+        fprintf(out, "    {\"name\": \"%s\", \"kind\": \"%s\", \"noise\": \"%s\", \"fractal\": \"%s\", \"warp\": \"%s\", "
+                     "\"cellular_distance\": \"%s\", \"cellular_return\": \"%s\", \"precision\": \"%s\", \"dims\": %d, \"pattern\": \"%s\", \"ns_per_sample\": %.3f}%s\n",
+            bench.name().c_str(), kinds[bench.kind],
+            bench.kind == BenchKind_Warp ? "" : noiseNames[bench.noiseType], fractalNames[bench.fractalType],
+            bench.kind == BenchKind_Warp ? warpNames[bench.warpType] : "",
+            cellular ? cellularDistanceNames[bench.cellularDistance] : "", cellular ? cellularReturnNames[bench.cellularReturn] : "",
+            bench.doubles ? "double" : "float", bench.dims, bench.kind == BenchKind_UniformGrid ? "uniformgrid" : bench.random ? "random" : "grid",
+            ns, i+1 < cases.size() ? "," : "");
+
+        if (out != stdout) fprintf(stderr, "[%zu/%zu] %s %.2f ns\n", i+1, cases.size(), bench.name().c_str(), ns);
+    }
+
+    fprintf(out, "  ]\n}\n");
+    if (out != stdout) fclose(out);
+
+    return 0;
+}
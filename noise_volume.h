@@ -0,0 +1,319 @@
+#ifndef NOISE_VOLUME_H
+#define NOISE_VOLUME_H
+
+#include "FastNoiseLite.hpp"
+#include "quantize.h"
+#include "thread_pool.h"
+#include "tile_scheduler.h"
+#include "w_slice_cache.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct CubeFace { // A side of the cube as a flat grid of voxels, in voxel coordinates
+    int x, y, z;
+    int sizeX, sizeY, sizeZ;
+    int axis, direction; // Which way the face points out of the cube
+};
+
+// Faces of a cube in the same order as NoiseVolume::faceSampled
+inline void cubeFaces(int sizeX, int sizeY, int sizeZ, CubeFace faces[5]){
+    faces[0] = {0, 0, 0, 1, sizeY, sizeZ, 0, -1};
+    faces[1] = {sizeX-1, 0, 0, 1, sizeY, sizeZ, 0, 1};
+    faces[2] = {0, sizeY-1, 0, sizeX, 1, sizeZ, 1, 1};
+    faces[3] = {0, 0, 0, sizeX, sizeY, 1, 2, -1};
+    faces[4] = {0, 0, sizeZ-1, sizeX, sizeY, 1, 2, 1};
+}
+
+// The whole cube as one box, sampled like a face that is sizeZ voxels deep
+inline CubeFace cubeInterior(int sizeX, int sizeY, int sizeZ){
+    return {0, 0, 0, sizeX, sizeY, sizeZ, 0, 0};
+}
+
+struct NoiseVolumeKey { // Everything that changes what the volume holds
+    float w;
+    int sizeX, sizeY, sizeZ;
+    int sampleScale;
+    int noiseMod;
+    unsigned settingsVersion; // Counts changes to the noise settings
+    int stride; // 1 for every voxel, above 1 for a quick preview that samples every stride voxels and repeats them in between
+
+    bool operator==(const NoiseVolumeKey& other) const {
+        return w == other.w && sizeX == other.sizeX && sizeY == other.sizeY && sizeZ == other.sizeZ && sampleScale == other.sampleScale && noiseMod == other.noiseMod &&
+               settingsVersion == other.settingsVersion && stride == other.stride;
+    }
+};
+
+struct NoiseVolume { // Noise for every voxel of the cube, x changes fastest then y then z, only the faces that have been seen are filled in
+    std::vector<uint16_t> values; // Quantized, a 250^3 volume takes 31MB instead of 62MB as floats
+    QuantizeRange range = QuantizeRange::between(-1, 1, 65535); // Noise is in -1 to 1, steps of 3e-5 are far finer than the 8 bit colors it ends up as
+    NoiseVolumeKey key = {};
+    bool faceSampled[5] = {}; // -x, +x, top, -z, +z
+    bool interiorSampled = false; // Every voxel is filled in, the faces included
+
+    uint16_t* at(int x, int y, int z){
+        return values.data() + ((size_t)z*key.sizeY + y)*key.sizeX + x;
+    }
+
+    void reset(const NoiseVolumeKey& newKey){ // Forget all samples, they are taken again when their face is next visible
+        key = newKey;
+        values.resize((size_t)key.sizeX*key.sizeY*key.sizeZ);
+        for (bool& sampled : faceSampled) sampled = false;
+        interiorSampled = false;
+    }
+};
+
+struct VolumeRequest { // What a VolumeGenerator should sample
+    FastNoiseLite noise; // Copied so the gui can keep changing settings while the volume is sampled
+    NoiseVolumeKey key;
+    bool faces[5];
+    bool warpPoints; // Domain warp fractals are sampled point by point
+    unsigned generation; // Sampling stops once the generator has been moved on to a newer generation
+    bool interior; // Sample every voxel instead of the faces, for views that see inside the cube
+};
+
+// Samples volumes on a thread of its own so the render loop never waits for noise
+// The front volume is the one being drawn, the generator fills a back volume and the two are swapped once it is complete
+class VolumeGenerator {
+public:
+    VolumeGenerator(ThreadPool& pool) : scheduler(pool), thread(&VolumeGenerator::run, this) {}
+
+    ~VolumeGenerator()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        quitting = true; // Drops the rest of a job in progress
+        wake.notify_all();
+        thread.join();
+    }
+
+    VolumeGenerator(const VolumeGenerator&) = delete;
+    VolumeGenerator& operator=(const VolumeGenerator&) = delete;
+
+    // Jobs of older generations are out of date, they stop at their next row and their volume is thrown away
+    // Call as soon as anything that goes into the volume changes so the job for the new settings can start right away
+    void setGeneration(unsigned newGeneration)
+    {
+        generation = newGeneration;
+    }
+
+    // True from start until the result is taken by finish
+    bool busy()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return pending;
+    }
+
+    // Starts sampling in the background, only call while not busy
+    // Faces or the interior the front volume already has for the same key are copied instead of sampled again
+    void start(const VolumeRequest& request, NoiseVolume& front)
+    {
+        job = request;
+        back.reset(request.key);
+
+        if (front.key == request.key && front.interiorSampled){
+            back.values = front.values;
+            std::fill(back.faceSampled, back.faceSampled+5, true);
+            back.interiorSampled = true;
+        } else if (front.key == request.key){
+            CubeFace faces[5];
+            cubeFaces(request.key.sizeX, request.key.sizeY, request.key.sizeZ, faces);
+
+            for (int f = 0; f < 5; f++){
+                if (!request.faces[f] || !front.faceSampled[f]) continue;
+                const CubeFace& face = faces[f];
+
+                for (int z = face.z; z < face.z+face.sizeZ; z++){
+                    for (int y = face.y; y < face.y+face.sizeY; y++){
+                        memcpy(back.at(face.x, y, z), front.at(face.x, y, z), face.sizeX*sizeof(uint16_t));
+                    }
+                }
+                back.faceSampled[f] = true;
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            pending = true;
+            done = false;
+        }
+        wake.notify_all();
+    }
+
+    // Swaps the finished back volume into front, returns false if sampling is still going, nothing was started or the job was cancelled
+    // milliseconds and samples are the time the job took and how many voxels it sampled
+    bool finish(NoiseVolume& front, double& milliseconds, double& samples)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!done) return false;
+
+        if (jobCancelled){ // Nothing to show, the generator is free for a request of the new generation
+            pending = false;
+            done = false;
+            return false;
+        }
+
+        std::swap(front, back);
+        milliseconds = jobMs;
+        samples = jobSamples;
+        pending = false;
+        done = false;
+        return true;
+    }
+
+private:
+    void run()
+    {
+        while (true){
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [&]{ return stopping || (pending && !done); });
+                if (stopping) return;
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            double samples = 0;
+
+            // Caches of faces that aren't seen give their memory back to the shared budget
+            for (int f = 0; f < 5; f++){
+                if (job.interior || !job.faces[f]) sliceCaches[f].release();
+            }
+            if (!job.interior) sliceCaches[InteriorCache].release();
+
+            CubeFace faces[5];
+            cubeFaces(job.key.sizeX, job.key.sizeY, job.key.sizeZ, faces);
+            for (int f = 0; f < 5 && !cancelled() && !job.interior; f++){
+                if (!job.faces[f] || back.faceSampled[f]) continue;
+
+                samples += sampleFace(f, faces[f]);
+                back.faceSampled[f] = true;
+            }
+
+            if (job.interior && !back.interiorSampled){ // Faces are part of the interior, they aren't sampled on their own
+                samples += sampleFace(InteriorCache, cubeInterior(job.key.sizeX, job.key.sizeY, job.key.sizeZ));
+                std::fill(back.faceSampled, back.faceSampled+5, true);
+                back.interiorSampled = true;
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            jobMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            jobSamples = samples;
+            jobCancelled = cancelled(); // Also drops a volume that was completed just after a change
+            done = true;
+        }
+    }
+
+    bool cancelled() const
+    {
+        return quitting || generation != job.generation;
+    }
+
+    // Returns how many voxels were actually sampled, f picks the slice cache
+    double sampleFace(int f, const CubeFace& face)
+    {
+        FastNoiseLite& noise = job.noise;
+        float w = job.key.w;
+        int scale = job.key.sampleScale;
+        int stride = std::max(1, job.key.stride);
+
+        FastNoiseLite::UniformGrid4DKernel gridKernel = noise.GetUniformGrid4DKernel(); // Noise generator specialized for the selected noise and fractal type
+
+        size_t cacheBudget = WSliceCache::MaxCachedFloats; // Shared by every cache, what the others hold is taken off
+        for (int i = 0; i < 6; i++){
+            if (i != f) cacheBudget -= std::min(cacheBudget, sliceCaches[i].cachedFloats());
+        }
+        bool useSliceCache = stride == 1 && !job.warpPoints && sliceCaches[f].prepare(noise, face.x*scale, face.y*scale, face.z*scale, face.sizeX, face.sizeY, face.sizeZ, scale, cacheBudget);
+        if (!useSliceCache) sliceCaches[f].release();
+
+        // Previews sample the voxels whose coordinates are all multiples of stride and every voxel takes the value of the sample at or before it,
+        // so faces agree where they meet, stride is 1 for full resolution
+        int firstX = face.x/stride, firstY = face.y/stride, firstZ = face.z/stride;
+        int rowLength = (face.x+face.sizeX-1)/stride - firstX + 1;
+        int rowsY = (face.y+face.sizeY-1)/stride - firstY + 1;
+        int rowsZ = (face.z+face.sizeZ-1)/stride - firstZ + 1;
+        int rowCount = rowsY*rowsZ;
+
+        // Tiles are in sample coordinates, rows are kept whole for the slice cache since it tracks w per row
+        int tileX = useSliceCache ? rowLength : TileScheduler::DefaultTileSize;
+        scheduler.run(rowLength, rowsY, rowsZ, tileX, TileScheduler::DefaultTileSize, TileScheduler::DefaultTileSize, [&](const Tile& tile){
+            std::vector<float> samples(tile.x1-tile.x0), voxels(stride > 1 ? face.sizeX : 0);
+
+            // Voxels along x covered by the tile's samples
+            int voxelX0 = std::max(face.x, (firstX+tile.x0)*stride);
+            int voxelX1 = std::min(face.x+face.sizeX, (firstX+tile.x1)*stride);
+
+            for (int sampleZ = tile.z0; sampleZ < tile.z1; sampleZ++){
+                for (int sampleY = tile.y0; sampleY < tile.y1; sampleY++){
+                    if (cancelled()) return; // Slice cache tiles are whole rows of the face, so this is checked per row and not only per tile
+
+                    int y = (firstY + sampleY)*stride;
+                    int z = (firstZ + sampleZ)*stride;
+                    float* out = samples.data();
+
+                    if (job.warpPoints){
+                        for (int i = tile.x0; i < tile.x1; i++){
+                            float wx = (float)(firstX + i)*stride*scale, wy = (float)y*scale, wz = (float)z*scale;
+
+                            noise.TransformDomainWarpCoordinate(wx, wy, wz); // Warp the xyz part, w is left as is
+
+                            *out++ = noise.GetNoise(wx, wy, wz, w); // Get 4d noise at the warped point
+                        }
+                    } else if (useSliceCache){
+                        sliceCaches[f].genRow(noise, out, (y-face.y) + (z-face.z)*face.sizeY, w); // Same noise as the grid kernel, only recomputed where w crossed into a new lattice cell
+                    } else {
+                        gridKernel(noise, out, (firstX+tile.x0)*stride*scale, y*scale, z*scale, w, tile.x1-tile.x0, 1, 1, 1, scale*stride); // Get 4d noise for the tile's part of the row at once
+                    }
+
+                    const float* rowNoise = samples.data();
+                    if (stride > 1){ // Spread the samples over the voxels they cover
+                        for (int x = voxelX0; x < voxelX1; x++) voxels[x-voxelX0] = samples[x/stride - firstX - tile.x0];
+                        rowNoise = voxels.data();
+                    }
+
+                    // The first voxel row of the face covered by the sample row holds it, with a stride of 1 that is the sample row itself
+                    int voxelY = std::max(y, face.y), voxelZ = std::max(z, face.z);
+                    uint16_t* codes = back.at(voxelX0, voxelY, voxelZ);
+                    quantizeRow(rowNoise, codes, voxelX1-voxelX0, back.range); // Row is still in cache, store it as 16 bit
+
+                    if (stride == 1) continue;
+
+                    // Other voxel rows covered by the sample row repeat it
+                    for (int copyZ = voxelZ; copyZ < std::min(z+stride, face.z+face.sizeZ); copyZ++){
+                        for (int copyY = voxelY; copyY < std::min(y+stride, face.y+face.sizeY); copyY++){
+                            if (copyY != voxelY || copyZ != voxelZ) memcpy(back.at(voxelX0, copyY, copyZ), codes, (voxelX1-voxelX0)*sizeof(uint16_t));
+                        }
+                    }
+                }
+            }
+        }, [&]{ return cancelled(); });
+
+        return (double)rowCount*rowLength;
+    }
+
+    TileScheduler scheduler;
+    NoiseVolume back;
+    VolumeRequest job = {};
+    static const int InteriorCache = 5;
+    WSliceCache sliceCaches[6]; // Per face and one for the interior, lets Perlin and Value noise skip most work while animating w, MaxCachedFloats for all of them together
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    bool pending = false; // A job was started and its result not yet taken
+    bool done = false;    // The back volume is complete
+    bool stopping = false;
+    bool jobCancelled = false; // The back volume is incomplete, its job was overtaken by a newer generation
+    double jobMs = 0, jobSamples = 0;
+    std::atomic<unsigned> generation{0}; // Newest generation, set from the render thread while a job runs
+    std::atomic<bool> quitting{false};
+
+    std::thread thread; // Last so everything above exists before it starts
+};
+
+#endif
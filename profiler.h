@@ -0,0 +1,145 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Per frame timings of named stages, kept for the last HistoryFrames frames so slow frames can be traced to a stage
+// Time spent in a stage is added up over the frame with Scope, endFrame moves the totals into the history
+// Stages are timed on one thread, work handed to other threads only counts through the thread waiting on it
+class Profiler {
+public:
+    static constexpr int HistoryFrames = 300; // 5 seconds at 60 fps
+
+    // Times the enclosing block and adds it to a stage
+    class Scope {
+    public:
+        Scope(Profiler& profiler, int stage) : profiler(profiler), stage(stage), start(std::chrono::steady_clock::now()) {}
+        ~Scope() { stop(); }
+
+        // Ends the timing before the block does, later calls do nothing
+        void stop()
+        {
+            if (stopped) return;
+            profiler.add(stage, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+            stopped = true;
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Profiler& profiler;
+        int stage;
+        std::chrono::steady_clock::time_point start;
+        bool stopped = false;
+    };
+
+    // Adds a stage and returns the index used to time it
+    // A job stage is work that finishes every so often, like a volume sampled in the background, its percentiles only count
+    // the frames a job was added in instead of being mostly empty frames
+    int addStage(const char* name, bool jobs = false)
+    {
+        stages.push_back(Stage());
+        stages.back().name = name;
+        stages.back().jobs = jobs;
+        return (int)stages.size() - 1;
+    }
+
+    int stageCount() const { return (int)stages.size(); }
+    const char* stageName(int stage) const { return stages[stage].name.c_str(); }
+
+    // items is whatever the stage works through, like noise samples, for a throughput figure
+    void add(int stage, double milliseconds, double items = 0)
+    {
+        stages[stage].frameMs += milliseconds;
+        stages[stage].frameItems += items;
+        stages[stage].frameAdds++;
+    }
+
+    void addItems(int stage, double items) { stages[stage].frameItems += items; }
+
+    void endFrame()
+    {
+        for (Stage& stage : stages){
+            stage.ms[next] = stage.frameMs;
+            stage.items[next] = stage.frameItems;
+            stage.adds[next] = stage.frameAdds;
+            stage.frameMs = 0;
+            stage.frameItems = 0;
+            stage.frameAdds = 0;
+        }
+        next = (next + 1)%HistoryFrames;
+        frames = std::min(frames + 1, HistoryFrames);
+    }
+
+    // Frame time of a stage that percent of the recorded frames are at or under, 50 is the median
+    // For a job stage it is the time per job over the jobs in the recorded frames
+    double percentile(int stage, double percent) const
+    {
+        std::vector<double> sorted;
+        for (int i = 0; i < frames; i++){
+            if (stages[stage].jobs && stages[stage].adds[i] == 0) continue;
+            sorted.push_back(stages[stage].ms[i]);
+        }
+        if (sorted.empty()) return 0;
+
+        size_t rank = std::min((size_t)(percent/100*sorted.size()), sorted.size() - 1);
+        std::nth_element(sorted.begin(), sorted.begin() + rank, sorted.end());
+        return sorted[rank];
+    }
+
+    // Items per second over the recorded frames, frames where the stage had nothing to do are left out
+    double itemsPerSecond(int stage) const
+    {
+        double items = 0, ms = 0;
+        for (int i = 0; i < frames; i++){
+            if (stages[stage].items[i] <= 0) continue;
+            items += stages[stage].items[i];
+            ms += stages[stage].ms[i];
+        }
+        return ms > 0 ? items/ms*1000 : 0;
+    }
+
+    // One row per recorded frame, oldest first, with the time of every stage in milliseconds
+    bool writeCsv(const std::string& path) const
+    {
+        FILE* file = fopen(path.c_str(), "w");
+        if (!file) return false;
+
+        fprintf(file, "frame");
+        for (const Stage& stage : stages) fprintf(file, ",%s ms,%s items", stage.name.c_str(), stage.name.c_str());
+        fprintf(file, "\n");
+
+        int first = frames < HistoryFrames ? 0 : next;
+        for (int i = 0; i < frames; i++){
+            int frame = (first + i)%HistoryFrames;
+
+            fprintf(file, "%d", i);
+            for (const Stage& stage : stages) fprintf(file, ",%.4f,%.0f", stage.ms[frame], stage.items[frame]);
+            fprintf(file, "\n");
+        }
+
+        return fclose(file) == 0;
+    }
+
+private:
+    struct Stage {
+        std::string name;
+        double ms[HistoryFrames] = {};
+        double items[HistoryFrames] = {};
+        int adds[HistoryFrames] = {}; // Times add was called in the frame
+        double frameMs = 0, frameItems = 0; // Totals of the frame in progress
+        int frameAdds = 0;
+        bool jobs = false;
+    };
+
+    std::vector<Stage> stages;
+    int next = 0;   // Slot the next finished frame goes into
+    int frames = 0; // Frames recorded so far, up to HistoryFrames
+};
+
+#endif
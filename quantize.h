@@ -0,0 +1,52 @@
+#ifndef QUANTIZE_H
+#define QUANTIZE_H
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+// Linear mapping between floats and 8 or 16 bit codes, value = code * scale + offset
+// Values outside the range are clamped to the first or last code
+struct QuantizeRange {
+    float scale;
+    float offset;
+
+    // Range where code 0 is min and the largest code is max
+    static QuantizeRange between(float min, float max, int maxCode){
+        return {(max - min)/maxCode, min};
+    }
+
+    float value(int code) const { return code*scale + offset; }
+};
+
+// NaN checked on the bits, -Ofast assumes there are no NaNs and may drop checks written as float compares
+inline bool isNaNBits(float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, 4);
+    return (bits & 0x7fffffff) > 0x7f800000; // All ones exponent with a nonzero mantissa
+}
+
+// Plain loops without branches or calls so they vectorize
+template<typename T>
+void quantizeRow(const float* values, T* codes, int count, QuantizeRange range)
+{
+    const float maxCode = (float)std::numeric_limits<T>::max();
+    const float invScale = 1/range.scale;
+
+    for (int i = 0; i < count; i++){
+        float q = (values[i] - range.offset)*invScale + 0.5f; // Rounds to nearest once truncated
+        q = isNaNBits(values[i]) ? 0 : q;
+        q = q > 0 ? q : 0;
+        q = q < maxCode ? q : maxCode;
+        codes[i] = (T)q;
+    }
+}
+
+template<typename T>
+void dequantizeRow(const T* codes, float* values, int count, QuantizeRange range)
+{
+    for (int i = 0; i < count; i++) values[i] = codes[i]*range.scale + range.offset;
+}
+
+#endif
@@ -0,0 +1,125 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of worker threads that split a range of independent tasks between them
+// The thread calling ParallelFor works on the range too and only returns once every task is finished
+class ThreadPool {
+public:
+    ThreadPool(int threadCount = 0)
+    {
+        if (threadCount <= 0) threadCount = (int)std::thread::hardware_concurrency();
+        if (threadCount <= 0) threadCount = 1;
+
+        for (int i = 1; i < threadCount; i++){ // The calling thread counts as one
+            workers.emplace_back(&ThreadPool::WorkerLoop, this);
+        }
+    }
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+
+        for (std::thread& worker : workers){
+            worker.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    int ThreadCount() const { return (int)workers.size() + 1; }
+
+    // Runs task(i) for every i in [0, count), tasks are handed out one index at a time so uneven tasks balance out
+    void ParallelFor(int count, const std::function<void(int)>& task)
+    {
+        if (count <= 0) return;
+        if (workers.empty() || count == 1){
+            for (int i = 0; i < count; i++) task(i);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            job = &task;
+            jobCount = count;
+            nextIndex = 0;
+            finished = 0;
+            jobId++;
+        }
+        wake.notify_all();
+
+        RunTasks(task, count);
+
+        // Workers still holding the job are waited on too, so none of them can pick up indices of the next one
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [&]{ return finished == count && activeWorkers == 0; });
+        job = nullptr;
+    }
+
+private:
+    void WorkerLoop()
+    {
+        unsigned long long seenJob = 0;
+
+        while (true){
+            const std::function<void(int)>* task;
+            int count;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [&]{ return stopping || (job != nullptr && jobId != seenJob); });
+                if (stopping) return;
+
+                seenJob = jobId;
+                task = job;
+                count = jobCount;
+                activeWorkers++;
+            }
+
+            RunTasks(*task, count);
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--activeWorkers == 0) done.notify_all();
+        }
+    }
+
+    void RunTasks(const std::function<void(int)>& task, int count)
+    {
+        int ran = 0;
+        for (int i = nextIndex++; i < count; i = nextIndex++){
+            task(i);
+            ran++;
+        }
+
+        if (ran > 0){
+            std::lock_guard<std::mutex> lock(mutex);
+            finished += ran;
+            if (finished == count) done.notify_all();
+        }
+    }
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+
+    const std::function<void(int)>* job = nullptr;
+    int jobCount = 0;
+    std::atomic<int> nextIndex{0};
+    int finished = 0;
+    int activeWorkers = 0;
+    unsigned long long jobId = 0;
+    bool stopping = false;
+};
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef TILE_SCHEDULER_H
+#define TILE_SCHEDULER_H
+
+#include "thread_pool.h"
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+struct Tile { // Box of cells, from x0 y0 z0 up to but not including x1 y1 z1
+    int x0, y0, z0;
+    int x1, y1, z1;
+};
+
+// Splits a box into tiles and runs them on a ThreadPool, the cost of a cell can vary a lot across a box (domain warp, cellular, octaves)
+// Each thread starts on its own run of neighbouring tiles from the front of its queue and once that is empty steals from the back of
+// another thread's queue, so threads stay busy without sharing one queue for every tile
+class TileScheduler {
+public:
+    static const int DefaultTileSize = 16;
+
+    TileScheduler(ThreadPool& pool) : pool(pool)
+    {
+        for (int i = 0; i < pool.ThreadCount(); i++) queues.emplace_back(new Queue());
+    }
+
+    TileScheduler(const TileScheduler&) = delete;
+    TileScheduler& operator=(const TileScheduler&) = delete;
+
+    // Runs task for every tile of a sizeX by sizeY by sizeZ box, tiles at the far edges are cut short
+    // cancelled is checked before each tile, once it returns true the remaining tiles are dropped and run returns false
+    // Only one run at a time per scheduler
+    bool run(int sizeX, int sizeY, int sizeZ, int tileX, int tileY, int tileZ, const std::function<void(const Tile&)>& task, const std::function<bool()>& cancelled = nullptr)
+    {
+        int tilesX = (sizeX+tileX-1)/tileX, tilesY = (sizeY+tileY-1)/tileY, tilesZ = (sizeZ+tileZ-1)/tileZ;
+        int tileCount = tilesX*tilesY*tilesZ;
+        if (tileCount <= 0) return true;
+
+        // Tiles in x, y, z order split into one run per thread, neighbouring tiles share caches better on the same thread
+        int workers = (int)queues.size();
+        for (int i = 0; i < tileCount; i++){
+            int tx = i%tilesX, ty = i/tilesX%tilesY, tz = i/(tilesX*tilesY);
+            Tile tile = {tx*tileX, ty*tileY, tz*tileZ, std::min((tx+1)*tileX, sizeX), std::min((ty+1)*tileY, sizeY), std::min((tz+1)*tileZ, sizeZ)};
+            queues[(size_t)i*workers/tileCount]->tiles.push_back(tile);
+        }
+
+        std::atomic<bool> stopped{false};
+
+        pool.ParallelFor(workers, [&](int self){
+            Tile tile;
+            while (take(self, tile)){
+                if (stopped || (cancelled && cancelled())){
+                    stopped = true;
+                    continue; // Keep taking tiles so every queue ends up empty for the next run
+                }
+                task(tile);
+            }
+        });
+
+        return !stopped;
+    }
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Tile> tiles;
+    };
+
+    // Next tile from the front of the thread's own queue, or the back of another one
+    bool take(int self, Tile& tile)
+    {
+        for (int i = 0; i < (int)queues.size(); i++){
+            Queue& queue = *queues[(self + i)%queues.size()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tiles.empty()) continue;
+
+            if (i == 0){
+                tile = queue.tiles.front();
+                queue.tiles.pop_front();
+            } else {
+                tile = queue.tiles.back();
+                queue.tiles.pop_back();
+            }
+            return true;
+        }
+        return false;
+    }
+
+    ThreadPool& pool;
+    std::vector<std::unique_ptr<Queue>> queues; // One per pool thread, unique_ptr since mutexes can't move
+};
+
+#endif
@@ -0,0 +1,380 @@
+#ifndef VOLUME_FILE_H
+#define VOLUME_FILE_H
+
+#include "FastNoiseLite.hpp"
+#include "quantize.h"
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+// windows.h clashes with raylib.h (CloseWindow, Rectangle, ...), so this header is for the command line tools only
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+// Chunked noise volume file
+//
+// [VolumeFileHeader][NoiseConfig][padding up to VolumeFileDataAlign][brick 0][brick 1]...
+//
+// Volumes are split into bricks of 32x32x32 voxels, x changes fastest inside a brick, bricks are ordered by x then y, z and w
+// Bricks on the far edges are padded to full size so every brick sits at a fixed offset and can be mapped and written on its own
+// Quantized formats store round((value - offset) / scale), so value = stored * scale + offset
+
+const char VolumeFileMagic[8] = {'N', 'O', 'I', 'S', 'E', 'V', 'O', 'L'};
+const uint32_t VolumeFileVersion = 1;
+const int VolumeBrickSize = 32;
+const int VolumeBrickVoxels = VolumeBrickSize*VolumeBrickSize*VolumeBrickSize;
+const uint64_t VolumeFileDataAlign = 65536; // Windows can only map views at 64KB offsets, every brick size is a multiple of this or divides it
+
+enum VolumeFormat : uint32_t {
+    VolumeFormat_Float32 = 0,
+    VolumeFormat_UInt8 = 1,
+    VolumeFormat_UInt16 = 2
+};
+
+inline int volumeFormatBytes(uint32_t format){
+    switch (format){
+    case VolumeFormat_UInt8: return 1;
+    case VolumeFormat_UInt16: return 2;
+    default: return 4;
+    }
+}
+
+// FastNoiseLite settings stored with the volume so it can be baked again or matched up with the explorer
+struct NoiseConfig {
+    int32_t seed;
+    float frequency;
+    int32_t noiseType;
+    int32_t rotationType3D;
+    int32_t fractalType;
+    int32_t octaves;
+    float lacunarity;
+    float gain;
+    float weightedStrength;
+    float pingPongStrength;
+    int32_t cellularDistanceFunction;
+    int32_t cellularReturnType;
+    float cellularJitter;
+    int32_t domainWarpType;
+    float domainWarpAmp;
+
+    static NoiseConfig from(const FastNoiseLite& noise){
+        NoiseConfig config;
+        config.seed = noise.mSeed;
+        config.frequency = noise.mFrequency;
+        config.noiseType = noise.mNoiseType;
+        config.rotationType3D = noise.mRotationType3D;
+        config.fractalType = noise.mFractalType;
+        config.octaves = noise.mOctaves;
+        config.lacunarity = noise.mLacunarity;
+        config.gain = noise.mGain;
+        config.weightedStrength = noise.mWeightedStrength;
+        config.pingPongStrength = noise.mPingPongStength;
+        config.cellularDistanceFunction = noise.mCellularDistanceFunction;
+        config.cellularReturnType = noise.mCellularReturnType;
+        config.cellularJitter = noise.mCellularJitterModifier;
+        config.domainWarpType = noise.mDomainWarpType;
+        config.domainWarpAmp = noise.mDomainWarpAmp;
+        return config;
+    }
+
+    void applyTo(FastNoiseLite& noise) const { // Goes through the setters so derived state is updated too
+        noise.SetSeed(seed);
+        noise.SetFrequency(frequency);
+        noise.SetNoiseType((FastNoiseLite::NoiseType)noiseType);
+        noise.SetRotationType3D((FastNoiseLite::RotationType3D)rotationType3D);
+        noise.SetFractalType((FastNoiseLite::FractalType)fractalType);
+        noise.SetFractalOctaves(octaves);
+        noise.SetFractalLacunarity(lacunarity);
+        noise.SetFractalGain(gain);
+        noise.SetFractalWeightedStrength(weightedStrength);
+        noise.SetFractalPingPongStrength(pingPongStrength);
+        noise.SetCellularDistanceFunction((FastNoiseLite::CellularDistanceFunction)cellularDistanceFunction);
+        noise.SetCellularReturnType((FastNoiseLite::CellularReturnType)cellularReturnType);
+        noise.SetCellularJitter(cellularJitter);
+        noise.SetDomainWarpType((FastNoiseLite::DomainWarpType)domainWarpType);
+        noise.SetDomainWarpAmp(domainWarpAmp);
+    }
+};
+
+struct VolumeFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t format;        // VolumeFormat
+    uint32_t sizeX, sizeY, sizeZ, sizeW; // Voxels on each axis, sizeW is the number of w slices
+    uint32_t brickSize;     // Always VolumeBrickSize
+    uint32_t configSize;    // sizeof(NoiseConfig) when written
+    uint64_t dataOffset;    // File offset of the first brick
+    float quantScale;       // Only used by quantized formats
+    float quantOffset;
+    float sampleScale;      // Distance between voxels in noise space
+    float wStart, wStep;    // w of the first slice and between slices
+
+    uint32_t bricksX() const { return (sizeX + brickSize - 1)/brickSize; }
+    uint32_t bricksY() const { return (sizeY + brickSize - 1)/brickSize; }
+    uint32_t bricksZ() const { return (sizeZ + brickSize - 1)/brickSize; }
+    uint64_t brickCount() const { return (uint64_t)bricksX()*bricksY()*bricksZ()*sizeW; }
+    uint64_t brickBytes() const { return (uint64_t)brickSize*brickSize*brickSize*volumeFormatBytes(format); }
+
+    uint64_t brickIndex(uint32_t bx, uint32_t by, uint32_t bz, uint32_t w) const {
+        return (((uint64_t)w*bricksZ() + bz)*bricksY() + by)*bricksX() + bx;
+    }
+
+    uint64_t brickOffset(uint64_t index) const { return dataOffset + index*brickBytes(); }
+    uint64_t fileSize() const { return brickOffset(brickCount()); }
+};
+
+// A mapped range of a file, unmapped when destroyed
+class FileView {
+public:
+    FileView() {}
+    ~FileView() { unmap(); }
+
+    FileView(const FileView&) = delete;
+    FileView& operator=(const FileView&) = delete;
+    FileView(FileView&& other) { *this = static_cast<FileView&&>(other); }
+    FileView& operator=(FileView&& other){
+        if (this != &other){
+            unmap();
+            base = other.base; baseSize = other.baseSize; data = other.data;
+            other.base = nullptr; other.data = nullptr;
+        }
+        return *this;
+    }
+
+    unsigned char* data = nullptr; // Start of the requested range, nullptr if mapping failed
+
+private:
+    friend class VolumeFile;
+
+    void unmap(){
+        if (!base) return;
+#if defined(_WIN32)
+        UnmapViewOfFile(base);
+#else
+        munmap(base, baseSize);
+#endif
+        base = nullptr;
+        data = nullptr;
+    }
+
+    void* base = nullptr; // Start of the mapping, aligned down from data
+    size_t baseSize = 0;
+};
+
+// Creates or opens a chunked volume file and maps parts of it on request
+// Views of different bricks can be written from different threads at the same time
+class VolumeFile {
+public:
+    VolumeFile() {}
+    ~VolumeFile() { close(); }
+
+    VolumeFile(const VolumeFile&) = delete;
+    VolumeFile& operator=(const VolumeFile&) = delete;
+
+    // Makes a new file of the full size with the header and config written, bricks start zeroed
+    // Disk space for every brick is reserved here, so a full disk fails create instead of a brick write through a mapping
+    bool create(const std::string& path, VolumeFileHeader newHeader, const NoiseConfig& newConfig){
+        close();
+
+        memcpy(newHeader.magic, VolumeFileMagic, sizeof(VolumeFileMagic));
+        newHeader.version = VolumeFileVersion;
+        newHeader.brickSize = VolumeBrickSize;
+        newHeader.configSize = sizeof(NoiseConfig);
+        newHeader.dataOffset = (sizeof(VolumeFileHeader) + sizeof(NoiseConfig) + VolumeFileDataAlign - 1)/VolumeFileDataAlign*VolumeFileDataAlign;
+        header = newHeader;
+        config = newConfig;
+        writable = true;
+
+        if (!openFile(path, true, true) || !resize(header.fileSize())){
+            close();
+            return false;
+        }
+
+        FileView start = map(0, sizeof(VolumeFileHeader) + sizeof(NoiseConfig));
+        if (!start.data){
+            close();
+            return false;
+        }
+        memcpy(start.data, &header, sizeof(VolumeFileHeader));
+        memcpy(start.data + sizeof(VolumeFileHeader), &config, sizeof(NoiseConfig));
+        return true;
+    }
+
+    // Opens an existing file and reads its header and config
+    bool open(const std::string& path, bool write = false){
+        close();
+        writable = write;
+
+        if (!openFile(path, write, false)){
+            close();
+            return false;
+        }
+
+        FileView start = map(0, sizeof(VolumeFileHeader));
+        if (!start.data){
+            close();
+            return false;
+        }
+        memcpy(&header, start.data, sizeof(VolumeFileHeader));
+
+        if (memcmp(header.magic, VolumeFileMagic, sizeof(VolumeFileMagic)) != 0 || header.version != VolumeFileVersion || header.brickSize != VolumeBrickSize){
+            close();
+            return false;
+        }
+
+        memset(&config, 0, sizeof(NoiseConfig));
+        FileView configView = map(sizeof(VolumeFileHeader), header.configSize);
+        if (configView.data) memcpy(&config, configView.data, header.configSize < sizeof(NoiseConfig) ? header.configSize : sizeof(NoiseConfig));
+        return true;
+    }
+
+    // Returns false if bricks written through views could not be stored, views are unmapped as soon as they go away
+    // but their pages are only written back here, flushing the file covers every view that was mapped from it
+    bool close(){
+        bool ok = true;
+#if defined(_WIN32)
+        if (writable && file != INVALID_HANDLE_VALUE) ok = FlushFileBuffers(file) != 0;
+        if (mapping) CloseHandle(mapping);
+        if (file != INVALID_HANDLE_VALUE && !CloseHandle(file)) ok = false;
+        mapping = nullptr;
+        file = INVALID_HANDLE_VALUE;
+#else
+        if (writable && file >= 0) ok = fsync(file) == 0; // Same as msync on every view, reports write back errors
+        if (file >= 0 && ::close(file) != 0) ok = false;
+        file = -1;
+#endif
+        return ok;
+    }
+
+    bool isOpen() const {
+#if defined(_WIN32)
+        return mapping != nullptr;
+#else
+        return file >= 0;
+#endif
+    }
+
+    // Maps size bytes starting at offset, offset doesn't need any alignment
+    FileView map(uint64_t offset, size_t size){
+        FileView view;
+        if (!isOpen() || size == 0) return view;
+
+        uint64_t alignedOffset = offset/VolumeFileDataAlign*VolumeFileDataAlign;
+        size_t mapSize = (size_t)(offset - alignedOffset) + size;
+#if defined(_WIN32)
+        void* base = MapViewOfFile(mapping, writable ? FILE_MAP_WRITE : FILE_MAP_READ, (DWORD)(alignedOffset >> 32), (DWORD)alignedOffset, mapSize);
+        if (!base) return view;
+#else
+        void* base = mmap(nullptr, mapSize, writable ? PROT_READ|PROT_WRITE : PROT_READ, MAP_SHARED, file, (off_t)alignedOffset);
+        if (base == MAP_FAILED) return view;
+#endif
+        view.base = base;
+        view.baseSize = mapSize;
+        view.data = (unsigned char*)base + (offset - alignedOffset);
+        return view;
+    }
+
+    FileView mapBrick(uint32_t bx, uint32_t by, uint32_t bz, uint32_t w){
+        uint64_t index = header.brickIndex(bx, by, bz, w);
+        return map(header.brickOffset(index), (size_t)header.brickBytes());
+    }
+
+    // Stores a brick of VolumeBrickVoxels floats, quantizing them if the file uses a quantized format
+    bool writeBrick(uint32_t bx, uint32_t by, uint32_t bz, uint32_t w, const float* values){
+        FileView view = mapBrick(bx, by, bz, w);
+        if (!view.data) return false;
+
+        encode(values, view.data, VolumeBrickVoxels);
+        return true;
+    }
+
+    // Reads a brick back as VolumeBrickVoxels floats
+    bool readBrick(uint32_t bx, uint32_t by, uint32_t bz, uint32_t w, float* values){
+        FileView view = mapBrick(bx, by, bz, w);
+        if (!view.data) return false;
+
+        decode(view.data, values, VolumeBrickVoxels);
+        return true;
+    }
+
+    void encode(const float* values, unsigned char* out, int count) const {
+        switch (header.format){
+        case VolumeFormat_UInt8:
+            quantizeRow(values, (uint8_t*)out, count, quantizeRange());
+            break;
+        case VolumeFormat_UInt16:
+            quantizeRow(values, (uint16_t*)out, count, quantizeRange());
+            break;
+        default:
+            memcpy(out, values, count*sizeof(float));
+            break;
+        }
+    }
+
+    void decode(const unsigned char* in, float* values, int count) const {
+        switch (header.format){
+        case VolumeFormat_UInt8:
+            dequantizeRow((const uint8_t*)in, values, count, quantizeRange());
+            break;
+        case VolumeFormat_UInt16:
+            dequantizeRow((const uint16_t*)in, values, count, quantizeRange());
+            break;
+        default:
+            memcpy(values, in, count*sizeof(float));
+            break;
+        }
+    }
+
+    VolumeFileHeader header = {};
+    NoiseConfig config = {};
+
+private:
+    QuantizeRange quantizeRange() const { return {header.quantScale, header.quantOffset}; }
+
+    bool openFile(const std::string& path, bool write, bool create){
+#if defined(_WIN32)
+        file = CreateFileA(path.c_str(), write ? GENERIC_READ|GENERIC_WRITE : GENERIC_READ, FILE_SHARE_READ, nullptr, create ? CREATE_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return false;
+        if (!create) return createMapping();
+        return true; // Mapping is made once the size is known in resize()
+#else
+        file = ::open(path.c_str(), create ? O_RDWR|O_CREAT|O_TRUNC : (write ? O_RDWR : O_RDONLY), 0644);
+        return file >= 0;
+#endif
+    }
+
+    // Sets the size with the space allocated, a sparse file would only run out of space when a mapped page is written and that is a SIGBUS
+    bool resize(uint64_t size){
+#if defined(_WIN32)
+        LARGE_INTEGER end;
+        end.QuadPart = (LONGLONG)size;
+        if (!SetFilePointerEx(file, end, nullptr, FILE_BEGIN) || !SetEndOfFile(file)) return false; // Allocates the space, files aren't sparse unless asked for
+        return createMapping();
+#else
+        return posix_fallocate(file, 0, (off_t)size) == 0;
+#endif
+    }
+
+#if defined(_WIN32)
+    bool createMapping(){
+        mapping = CreateFileMappingA(file, nullptr, writable ? PAGE_READWRITE : PAGE_READONLY, 0, 0, nullptr);
+        return mapping != nullptr;
+    }
+
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#else
+    int file = -1;
+#endif
+    bool writable = false;
+};
+
+#endif
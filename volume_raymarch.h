@@ -0,0 +1,201 @@
+#ifndef VOLUME_RAYMARCH_H
+#define VOLUME_RAYMARCH_H
+
+#include "raylib.h"
+#include "rlgl.h"
+#include "colormap.h"
+#include "noise_volume.h"
+#include <cmath>
+#include <vector>
+
+// Draws a sampled volume by marching rays through it in a fragment shader, so the interior can be seen and the cost doesn't grow with the voxel count
+// raylib has no 3d textures, the z slices are laid side by side in one 8 bit texture instead and the shader blends between neighbouring slices
+// Voxels below the threshold are clear, the rest get the palette color and opacity per voxel they are crossed for
+class VolumeRaymarcher {
+public:
+    static const int PaletteSize = 256; // Same steps as the 8 bit slices
+
+    VolumeRaymarcher() {}
+    ~VolumeRaymarcher() { clear(); }
+
+    VolumeRaymarcher(const VolumeRaymarcher&) = delete;
+    VolumeRaymarcher& operator=(const VolumeRaymarcher&) = delete;
+
+    // Compiles the shader and makes the cube it is drawn on, needs the window to be open
+    void load()
+    {
+        if (loaded) return;
+
+        shader = LoadShaderCode(vertexShader, fragmentShader);
+        shader.locs[LOC_MATRIX_MODEL] = GetShaderLocation(shader, "matModel");
+        cameraLoc = GetShaderLocation(shader, "cameraPosition");
+        sizeLoc = GetShaderLocation(shader, "volumeSize");
+        atlasSizeLoc = GetShaderLocation(shader, "atlasSize");
+        columnsLoc = GetShaderLocation(shader, "atlasColumns");
+        thresholdLoc = GetShaderLocation(shader, "threshold");
+        opacityLoc = GetShaderLocation(shader, "opacity");
+
+        Image paletteImage = GenImageColor(PaletteSize, 1, WHITE);
+        palette = LoadTextureFromImage(paletteImage);
+        UnloadImage(paletteImage);
+        SetTextureFilter(palette, FILTER_BILINEAR);
+        SetTextureWrap(palette, WRAP_CLAMP);
+
+        cube = LoadModelFromMesh(GenMeshCube(1, 1, 1));
+        cube.materials[0].shader = shader;
+        cube.materials[0].maps[MAP_SPECULAR].texture = palette; // Bound as texture1
+
+        loaded = true;
+    }
+
+    // Colors for the values -1 to 1, only needs calling when the palette changes
+    void setPalette(const Colormap& colormap)
+    {
+        float values[PaletteSize];
+        unsigned char rgba[PaletteSize*4];
+        for (int i = 0; i < PaletteSize; i++) values[i] = (float)i/(PaletteSize-1)*2 - 1;
+
+        colormap.mapValues(values, rgba, PaletteSize);
+        UpdateTexture(palette, rgba);
+    }
+
+    // Copies the volume into the slice texture, only call once per new volume since a 250^3 cube is 15MB to send
+    void upload(NoiseVolume& volume)
+    {
+        int sizeX = volume.key.sizeX, sizeY = volume.key.sizeY, sizeZ = volume.key.sizeZ;
+
+        // Close to square so neither side runs past the texture size limit, a 250^3 cube fits in 4000x4000
+        int newColumns = (int)ceilf(sqrtf((float)sizeZ));
+        int width = newColumns*sizeX, height = (sizeZ+newColumns-1)/newColumns*sizeY;
+
+        pixels.resize((size_t)width*height);
+        for (int z = 0; z < sizeZ; z++){
+            int tileX = z%newColumns*sizeX, tileY = z/newColumns*sizeY;
+
+            for (int y = 0; y < sizeY; y++){
+                const uint16_t* codes = volume.at(0, y, z);
+                unsigned char* out = pixels.data() + (size_t)(tileY+y)*width + tileX;
+                for (int x = 0; x < sizeX; x++) out[x] = (unsigned char)(codes[x] >> 8); // -1 to 1 as 0 to 255, the top byte of the 16 bit code
+            }
+        }
+
+        if (width != atlas.width || height != atlas.height){ // Texture size only changes with the cube size
+            if (atlas.id > 0) UnloadTexture(atlas);
+
+            Image image = { pixels.data(), width, height, 1, UNCOMPRESSED_GRAYSCALE };
+            atlas = LoadTextureFromImage(image);
+            SetTextureFilter(atlas, FILTER_BILINEAR); // Bilinear within a slice, the shader blends between slices
+            SetTextureWrap(atlas, WRAP_CLAMP);
+            cube.materials[0].maps[MAP_DIFFUSE].texture = atlas; // Bound as texture0
+        } else {
+            UpdateTexture(atlas, pixels.data());
+        }
+
+        columns = newColumns;
+        size = { (float)sizeX, (float)sizeY, (float)sizeZ };
+    }
+
+    bool hasVolume() const { return atlas.id > 0; }
+
+    // Draws the last uploaded volume in voxel coordinates, the same place as the voxel mesh, call inside BeginMode3D
+    // threshold is the noise value where voxels start to show, opacity is how much light a shown voxel blocks
+    void draw(const Camera3D& camera, float threshold, float opacity)
+    {
+        if (!loaded || !hasVolume()) return;
+
+        Vector2 atlasSize = { (float)atlas.width, (float)atlas.height };
+        float atlasColumns = (float)columns;
+        SetShaderValue(shader, cameraLoc, &camera.position, UNIFORM_VEC3);
+        SetShaderValue(shader, sizeLoc, &size, UNIFORM_VEC3);
+        SetShaderValue(shader, atlasSizeLoc, &atlasSize, UNIFORM_VEC2);
+        SetShaderValue(shader, columnsLoc, &atlasColumns, UNIFORM_FLOAT);
+        SetShaderValue(shader, thresholdLoc, &threshold, UNIFORM_FLOAT);
+        SetShaderValue(shader, opacityLoc, &opacity, UNIFORM_FLOAT);
+
+        // Rays start at the back faces and walk back to where they entered the cube, that still works with the camera inside it
+        rlDisableBackfaceCulling();
+        DrawModelEx(cube, {(size.x-1)/2, (size.y-1)/2, (size.z-1)/2}, {0, 1, 0}, 0, size, WHITE);
+        rlEnableBackfaceCulling();
+    }
+
+    // Frees the shader and textures, has to happen before the window is closed
+    void clear()
+    {
+        if (!loaded) return;
+
+        UnloadModel(cube); // Leaves the shader and textures to us
+        UnloadShader(shader);
+        UnloadTexture(palette);
+        if (atlas.id > 0) UnloadTexture(atlas);
+        atlas = { 0 };
+        loaded = false;
+    }
+
+private:
+    static constexpr const char* vertexShader =
+        "#version 330\n"
+        "in vec3 vertexPosition;\n"
+        "uniform mat4 mvp;\n"
+        "uniform mat4 matModel;\n"
+        "out vec3 worldPosition;\n"
+        "void main(){\n"
+        "    worldPosition = (matModel*vec4(vertexPosition, 1.0)).xyz;\n"
+        "    gl_Position = mvp*vec4(vertexPosition, 1.0);\n"
+        "}\n";
+
+    static constexpr const char* fragmentShader =
+        "#version 330\n"
+        "in vec3 worldPosition;\n"
+        "uniform sampler2D texture0;\n" // Z slices side by side, atlasColumns to a row
+        "uniform sampler2D texture1;\n" // Palette for values -1 to 1
+        "uniform vec3 cameraPosition;\n"
+        "uniform vec3 volumeSize;\n"
+        "uniform vec2 atlasSize;\n"
+        "uniform float atlasColumns;\n"
+        "uniform float threshold;\n"
+        "uniform float opacity;\n"
+        "out vec4 finalColor;\n"
+        "const float stepSize = 0.5;\n" // In voxels, half a voxel so thin features aren't stepped over
+        "float slice(vec2 xy, float z){\n"
+        "    vec2 tile = vec2(mod(z, atlasColumns), floor(z/atlasColumns));\n"
+        "    return texture(texture0, (tile*volumeSize.xy + xy + 0.5)/atlasSize).r;\n"
+        "}\n"
+        "float value(vec3 p){\n" // Voxels are centered on whole numbers, kept inside the outer voxel centers so filtering stays inside a slice
+        "    p = clamp(p, vec3(0.0), volumeSize - 1.0);\n"
+        "    float z0 = floor(p.z);\n"
+        "    float z1 = min(z0 + 1.0, volumeSize.z - 1.0);\n"
+        "    return mix(slice(p.xy, z0), slice(p.xy, z1), p.z - z0)*2.0 - 1.0;\n"
+        "}\n"
+        "void main(){\n"
+        "    if (gl_FrontFacing) discard;\n"
+        "    vec3 ray = worldPosition - cameraPosition;\n"
+        "    float end = length(ray);\n"
+        "    vec3 direction = ray/end;\n"
+        "    vec3 t0 = (vec3(-0.5) - cameraPosition)/direction, t1 = (volumeSize - 0.5 - cameraPosition)/direction;\n"
+        "    vec3 near = min(t0, t1);\n"
+        "    float t = max(max(max(near.x, near.y), near.z), 0.0);\n"
+        "    vec4 sum = vec4(0.0);\n"
+        "    for (int i = 0; i < 4096 && t < end && sum.a < 0.99; i++){\n" // Front to back, stops once the ray is close to opaque
+        "        float v = value(cameraPosition + direction*t);\n"
+        "        float a = opacity*smoothstep(threshold, threshold + 0.05, v);\n"
+        "        a = 1.0 - pow(1.0 - a, stepSize);\n" // Opacity is per voxel, corrected for the step length
+        "        vec3 color = texture(texture1, vec2((v*0.5 + 0.5)*(255.0/256.0) + 0.5/256.0, 0.5)).rgb;\n"
+        "        sum += (1.0 - sum.a)*vec4(color*a, a);\n"
+        "        t += stepSize;\n"
+        "    }\n"
+        "    if (sum.a < 0.002) discard;\n"
+        "    finalColor = vec4(sum.rgb/sum.a, sum.a);\n"
+        "}\n";
+
+    Shader shader = { 0 };
+    Model cube = { 0 };
+    Texture2D atlas = { 0 };   // 8 bit z slices, remade when the cube size changes
+    Texture2D palette = { 0 };
+    std::vector<unsigned char> pixels;
+    Vector3 size = { 0, 0, 0 };
+    int columns = 1;
+    int cameraLoc = -1, sizeLoc = -1, atlasSizeLoc = -1, columnsLoc = -1, thresholdLoc = -1, opacityLoc = -1;
+    bool loaded = false;
+};
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef VOXEL_MESH_H
+#define VOXEL_MESH_H
+
+#include "raylib.h"
+#include "rlgl.h"
+#include <vector>
+
+struct VoxelSide { // One side of a 1x1x1 voxel
+    Vector3 center; // Center of the voxel
+    int axis;       // 0 for x, 1 for y, 2 for z
+    int direction;  // -1 or 1, which way along the axis the side faces
+};
+
+// Sides of voxels kept in a single mesh so they are drawn with one call, only the sides that can be seen need adding
+// Positions are only uploaded when the set of sides changes, colors can be updated on their own
+class VoxelMesh {
+public:
+    static const int VerticesPerSide = 6; // 2 triangles, not indexed since indices are 16 bit
+
+    VoxelMesh() {}
+    ~VoxelMesh() { clear(); }
+
+    VoxelMesh(const VoxelMesh&) = delete;
+    VoxelMesh& operator=(const VoxelMesh&) = delete;
+
+    // Replaces every side in the mesh, sides start out black
+    void setSides(const std::vector<VoxelSide>& newSides)
+    {
+        clear();
+        sides = (int)newSides.size();
+        if (sides == 0) return;
+
+        Mesh mesh = { 0 };
+        mesh.vertexCount = sides*VerticesPerSide;
+        mesh.triangleCount = sides*2;
+        mesh.vertices = (float*)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+        mesh.colors = (unsigned char*)RL_CALLOC(mesh.vertexCount*4, sizeof(unsigned char));
+        mesh.vboId = (unsigned int*)RL_CALLOC(7, sizeof(unsigned int)); // DEFAULT_MESH_VERTEX_BUFFERS (models.c)
+
+        float* vertex = mesh.vertices;
+        for (const VoxelSide& side : newSides){
+            // Tangent axes ordered so the corners wind counter clockwise seen from outside
+            int u = side.direction > 0 ? (side.axis+1)%3 : (side.axis+2)%3;
+            int v = side.direction > 0 ? (side.axis+2)%3 : (side.axis+1)%3;
+            const int corners[6][2] = { {-1, -1}, {1, -1}, {1, 1}, {-1, -1}, {1, 1}, {-1, 1} };
+
+            for (const int* corner : corners){
+                float offset[3];
+                offset[side.axis] = side.direction*0.5f;
+                offset[u] = corner[0]*0.5f;
+                offset[v] = corner[1]*0.5f;
+
+                *vertex++ = side.center.x + offset[0];
+                *vertex++ = side.center.y + offset[1];
+                *vertex++ = side.center.z + offset[2];
+            }
+        }
+
+        rlLoadMesh(&mesh, true); // Dynamic so colors can be updated often
+        model = LoadModelFromMesh(mesh);
+        loaded = true;
+    }
+
+    int sideCount() const { return sides; }
+
+    void setColor(int side, Color color)
+    {
+        unsigned char* out = model.meshes[0].colors + side*VerticesPerSide*4;
+        for (int i = 0; i < VerticesPerSide; i++){
+            *out++ = color.r;
+            *out++ = color.g;
+            *out++ = color.b;
+            *out++ = color.a;
+        }
+    }
+
+    // Colors for count sides in a row starting at firstSide
+    void setColors(int firstSide, const Color* colors, int count)
+    {
+        for (int i = 0; i < count; i++) setColor(firstSide + i, colors[i]);
+    }
+
+    // Sends the colors set since the last upload to the gpu
+    void uploadColors()
+    {
+        if (loaded) rlUpdateMesh(model.meshes[0], 3, model.meshes[0].vertexCount);
+    }
+
+    void draw()
+    {
+        if (loaded) DrawModel(model, {0, 0, 0}, 1, WHITE);
+    }
+
+    // Frees the mesh, has to happen before the window is closed
+    void clear()
+    {
+        if (loaded) UnloadModel(model);
+        loaded = false;
+        sides = 0;
+    }
+
+private:
+    Model model = { 0 };
+    bool loaded = false;
+    int sides = 0;
+};
+
+#endif
@@ -0,0 +1,258 @@
+#ifndef W_SLICE_CACHE_H
+#define W_SLICE_CACHE_H
+
+#include "FastNoiseLite.hpp"
+#include <vector>
+#include <climits>
+
+// Samples a fixed xyz grid of 4D Perlin or Value noise at a w that changes over time
+// 4D Perlin and Value noise interpolate between two 3D lattice slices at the w cells either side of the point,
+// each octave of each point keeps both slices and only recomputes them once w moves into another cell
+// When w moves up by a single cell the upper slice becomes the lower one and only one slice is computed
+class WSliceCache {
+public:
+    // Default limit on cached floats, 64MB, bigger grids go back to sampling without the cache
+    // It is a total for every cache of a VolumeGenerator too, the explorer is a 32 bit build and also holds two 31MB volumes
+    static const size_t MaxCachedFloats = 16*1024*1024;
+
+    static bool supports(const FastNoiseLite& noise)
+    {
+        return noise.mNoiseType == FastNoiseLite::NoiseType_Perlin || noise.mNoiseType == FastNoiseLite::NoiseType_Value;
+    }
+
+    // Sets up the grid, same layout as FastNoiseLite::GenUniformGrid4D with a wSize of 1, rows are along x
+    // Keeps the cached slices when nothing that goes into them has changed, returns false if the grid can't be cached
+    // in maxFloats, the memory of a cache that can't be used is freed
+    bool prepare(const FastNoiseLite& noise, float xStart, float yStart, float zStart, int xSize, int ySize, int zSize, float step, size_t maxFloats = MaxCachedFloats)
+    {
+        if (!supports(noise)){
+            release();
+            return false;
+        }
+
+        Key newKey = {noise.mNoiseType, isFractal(noise) ? noise.mOctaves : 1, noise.mSeed, noise.mFrequency, noise.mLacunarity,
+                      xStart, yStart, zStart, xSize, ySize, zSize, step};
+        size_t rows = (size_t)ySize*zSize;
+        if (rows*newKey.octaves*xSize*SliceFloats > maxFloats){
+            release();
+            return false;
+        }
+
+        if (!(newKey == key)){
+            key = newKey;
+            std::vector<float>(rows*key.octaves*xSize*SliceFloats, 0).swap(slices); // Not assign, a smaller grid should give memory back
+            rowCells.assign(rows*key.octaves, INT_MIN);
+        }
+        return true;
+    }
+
+    // Forget every cached slice
+    void invalidate()
+    {
+        key = Key();
+    }
+
+    // Forget every cached slice and give back the memory
+    void release()
+    {
+        key = Key();
+        std::vector<float>().swap(slices);
+        std::vector<int>().swap(rowCells);
+    }
+
+    size_t cachedFloats() const { return slices.capacity(); }
+
+    // Noise for one row of the prepared grid at w, row is y + z * ySize
+    // Rows only touch their own part of the cache so different rows can be sampled from different threads
+    void genRow(FastNoiseLite& noise, float* noiseOut, int row, float w)
+    {
+        const int chunkSize = FastNoiseLite::GridChunkSize;
+
+        FastNoiseLite::FractalOctave tableOctaves[FastNoiseLite::GridTableOctaves];
+        std::vector<FastNoiseLite::FractalOctave> bigOctaves;
+        FastNoiseLite::FractalOctave* octaves = tableOctaves;
+        bool fractal = isFractal(noise);
+
+        if (fractal){
+            if (key.octaves > FastNoiseLite::GridTableOctaves){
+                bigOctaves.resize(key.octaves);
+                octaves = bigOctaves.data();
+            }
+            noise.BuildFractalOctaves(octaves);
+        } else {
+            octaves[0] = {1, 1, noise.mSeed};
+        }
+
+        // Same transformed coordinates as GenUniformGrid4D
+        float rowX = key.xStart * key.frequency;
+        float rowY = (key.yStart + (row % key.ySize) * key.step) * key.frequency;
+        float rowZ = (key.zStart + (row / key.ySize) * key.step) * key.frequency;
+        float rowW = w * key.frequency;
+        float xStep = key.step * key.frequency;
+
+        float noise1[chunkSize], amps[chunkSize];
+
+        for (int i0 = 0; i0 < key.xSize; i0 += chunkSize){
+            int count = key.xSize - i0 < chunkSize ? key.xSize - i0 : chunkSize;
+            float* out = noiseOut + i0;
+
+            for (int c = 0; c < count; c++){
+                out[c] = 0;
+                amps[c] = noise.mFractalBounding;
+            }
+
+            for (int o = 0; o < key.octaves; o++){
+                float frequency = octaves[o].frequency;
+                int seed = octaves[o].seed;
+                float wo = rowW * frequency;
+                int cell = FastNoiseLite::FastFloor(wo);
+                float wd0 = (float)(wo - cell);
+
+                // w is the same along the row, so the whole row of an octave moves to a new w cell at once
+                int& cachedCell = rowCells[(size_t)row*key.octaves + o];
+                float* rowSlices = slices.data() + (((size_t)row*key.octaves + o)*key.xSize)*SliceFloats;
+                bool stepUp = cachedCell != INT_MIN && cell == cachedCell + 1;
+
+                for (int c = 0; c < count; c++){
+                    float* slice = rowSlices + (size_t)(i0 + c)*SliceFloats;
+
+                    if (cell != cachedCell){
+                        float x = (rowX + (i0 + c) * xStep) * frequency;
+                        float y = rowY * frequency;
+                        float z = rowZ * frequency;
+
+                        if (stepUp){
+                            slice[0] = slice[2];
+                            slice[1] = slice[3];
+                        } else {
+                            computeSlice(seed, x, y, z, cell, slice);
+                        }
+                        computeSlice(seed, x, y, z, cell + 1, slice + 2);
+                    }
+
+                    if (key.noiseType == FastNoiseLite::NoiseType_Perlin)
+                        noise1[c] = FastNoiseLite::Lerp(slice[0] + slice[1] * wd0, slice[2] + slice[3] * (wd0 - 1), FastNoiseLite::InterpQuintic(wd0)) * 0.797474f;
+                    else
+                        noise1[c] = FastNoiseLite::Lerp(slice[0], slice[2], FastNoiseLite::InterpHermite(wd0));
+                }
+
+                if (i0 + count >= key.xSize) cachedCell = cell; // Marked after the last chunk so every chunk sees the old cell
+
+                if (!fractal){
+                    for (int c = 0; c < count; c++) out[c] = noise1[c];
+                } else {
+                    combine(noise, out, noise1, amps, octaves[o].amplitude, count);
+                }
+            }
+        }
+    }
+
+private:
+    static const int SliceFloats = 4; // Perlin keeps the xyz part and the w gradient of both slices, Value only uses [0] and [2]
+
+    struct Key {
+        FastNoiseLite::NoiseType noiseType = FastNoiseLite::NoiseType_OpenSimplex2;
+        int octaves = 0;
+        int seed = 0;
+        float frequency = 0, lacunarity = 0;
+        float xStart = 0, yStart = 0, zStart = 0;
+        int xSize = 0, ySize = 0, zSize = 0;
+        float step = 0;
+
+        bool operator==(const Key& other) const {
+            return noiseType == other.noiseType && octaves == other.octaves && seed == other.seed && frequency == other.frequency && lacunarity == other.lacunarity &&
+                   xStart == other.xStart && yStart == other.yStart && zStart == other.zStart &&
+                   xSize == other.xSize && ySize == other.ySize && zSize == other.zSize && step == other.step;
+        }
+    };
+
+    static bool isFractal(const FastNoiseLite& noise)
+    {
+        return noise.mFractalType == FastNoiseLite::FractalType_FBm || noise.mFractalType == FastNoiseLite::FractalType_Ridged || noise.mFractalType == FastNoiseLite::FractalType_PingPong;
+    }
+
+    // The xyz part of FastNoiseLite::SinglePerlin/SingleValue at one w lattice cell
+    void computeSlice(int seed, float x, float y, float z, int wCell, float* slice)
+    {
+        int x0 = FastNoiseLite::FastFloor(x);
+        int y0 = FastNoiseLite::FastFloor(y);
+        int z0 = FastNoiseLite::FastFloor(z);
+
+        float xd0 = (float)(x - x0);
+        float yd0 = (float)(y - y0);
+        float zd0 = (float)(z - z0);
+
+        x0 *= FastNoiseLite::PrimeX;
+        y0 *= FastNoiseLite::PrimeY;
+        z0 *= FastNoiseLite::PrimeZ;
+        int w0 = wCell * FastNoiseLite::PrimeW;
+
+        if (key.noiseType == FastNoiseLite::NoiseType_Value){
+            float xs = FastNoiseLite::InterpHermite(xd0);
+            float ys = FastNoiseLite::InterpHermite(yd0);
+            float zs = FastNoiseLite::InterpHermite(zd0);
+            float corners[8];
+
+            for (int i = 0; i < 8; i++){
+                corners[i] = FastNoiseLite::ValCoord(seed, x0 + (i & 1 ? FastNoiseLite::PrimeX : 0), y0 + (i & 2 ? FastNoiseLite::PrimeY : 0), z0 + (i & 4 ? FastNoiseLite::PrimeZ : 0), w0);
+            }
+            slice[0] = trilinear(corners, xs, ys, zs);
+            slice[1] = 0;
+            return;
+        }
+
+        float xs = FastNoiseLite::InterpQuintic(xd0);
+        float ys = FastNoiseLite::InterpQuintic(yd0);
+        float zs = FastNoiseLite::InterpQuintic(zd0);
+        float dots[8], wGradients[8];
+
+        for (int i = 0; i < 8; i++){
+            int hash = FastNoiseLite::Hash(seed, x0 + (i & 1 ? FastNoiseLite::PrimeX : 0), y0 + (i & 2 ? FastNoiseLite::PrimeY : 0), z0 + (i & 4 ? FastNoiseLite::PrimeZ : 0), w0);
+            hash ^= hash >> 15;
+            hash &= 63 << 2;
+
+            // Same as FastNoiseLite::GradCoord with the w term kept apart, it is added on once wd is known
+            float xd = i & 1 ? xd0 - 1 : xd0;
+            float yd = i & 2 ? yd0 - 1 : yd0;
+            float zd = i & 4 ? zd0 - 1 : zd0;
+            dots[i] = xd * FastNoiseLite::Lookup<float>::Gradients4D[hash] + yd * FastNoiseLite::Lookup<float>::Gradients4D[hash | 1] + zd * FastNoiseLite::Lookup<float>::Gradients4D[hash | 2];
+            wGradients[i] = FastNoiseLite::Lookup<float>::Gradients4D[hash | 3];
+        }
+        slice[0] = trilinear(dots, xs, ys, zs);
+        slice[1] = trilinear(wGradients, xs, ys, zs);
+    }
+
+    static float trilinear(const float* corners, float xs, float ys, float zs)
+    {
+        float y0 = FastNoiseLite::Lerp(FastNoiseLite::Lerp(corners[0], corners[1], xs), FastNoiseLite::Lerp(corners[2], corners[3], xs), ys);
+        float y1 = FastNoiseLite::Lerp(FastNoiseLite::Lerp(corners[4], corners[5], xs), FastNoiseLite::Lerp(corners[6], corners[7], xs), ys);
+        return FastNoiseLite::Lerp(y0, y1, zs);
+    }
+
+    static void combine(FastNoiseLite& noise, float* out, const float* octaveNoise, float* amps, float amp, int count)
+    {
+        bool weighted = noise.mWeightedStrength != 0;
+
+        switch (noise.mFractalType){
+        default:
+        case FastNoiseLite::FractalType_FBm:
+            if (weighted) noise.CombineWeightedFractalChunk<FastNoiseLite::FractalType_FBm>(out, octaveNoise, amps, count);
+            else noise.CombineFractalChunk<FastNoiseLite::FractalType_FBm>(out, octaveNoise, amp, count);
+            break;
+        case FastNoiseLite::FractalType_Ridged:
+            if (weighted) noise.CombineWeightedFractalChunk<FastNoiseLite::FractalType_Ridged>(out, octaveNoise, amps, count);
+            else noise.CombineFractalChunk<FastNoiseLite::FractalType_Ridged>(out, octaveNoise, amp, count);
+            break;
+        case FastNoiseLite::FractalType_PingPong:
+            if (weighted) noise.CombineWeightedFractalChunk<FastNoiseLite::FractalType_PingPong>(out, octaveNoise, amps, count);
+            else noise.CombineFractalChunk<FastNoiseLite::FractalType_PingPong>(out, octaveNoise, amp, count);
+            break;
+        }
+    }
+
+    Key key;
+    std::vector<float> slices;  // SliceFloats per point per octave, points of a row are together
+    std::vector<int> rowCells;  // w cell of the lower slice for each row and octave, INT_MIN when nothing is cached
+};
+
+#endif